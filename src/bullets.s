@@ -0,0 +1,267 @@
+; Bullet kernel - fused move / collide / OAM pass over the live bullet list
+; Hand-written version of bullet_kernel_ref() in main.c (make BULLETS_C_REF=1)
+;
+; unsigned char __fastcall__ bullet_kernel(unsigned char id);
+;   A  = first free sprite id, returns next free sprite id
+;   bk_* variables below are the other inputs/outputs (set by bullet_pass)
+;
+; Bullet arrays are structure-of-arrays, indexed by slot in X
+; Positions are 8.8 (bullet_x + bullet_xf); the 8.8 velocity comes from the
+; vel_* ROM tables (build/tables.s), indexed in Y by the bullet's velocity id
+; Hit/graze boxes use unsigned range compares against the graze box corner
+; (bk_xlo/bk_ylo = player center - 9): |d| < 10 <=> (p - lo) < 19, and
+; |d| < 4 <=> (p - lo - 6) < 7. Valid because bullet and player centers are
+; never 128+ px apart. The vertical band is tested first (broadphase).
+; With -D SPRITES_8X16 a bullet in the same column as the previous bullet
+; sprite and 0-8 px from it is stacked into that sprite (pair tiles).
+
+.export _bullet_kernel
+.export _bk_xlo, _bk_ylo, _bk_odd, _bk_all, _bk_oam
+.export _bk_step, _bk_collide, _bk_limit, _bk_hit, _bk_graze, _bk_pairs, _bk_shed
+
+.import _bullet_x, _bullet_y, _bullet_xf, _bullet_yf
+.import _bullet_vel, _bullet_flags, _bullet_slot, _bullet_count
+.import _vel_dxf, _vel_dx, _vel_dyf, _vel_dy
+
+; Must match main.c
+SPR_BULLET  = $0B               ; Diamond bullet tile
+BULLET_PAL  = 2                 ; Sprite palette 2 (yellow)
+OAM         = $0200             ; OAM buffer
+OAM_PINNED  = 6                 ; OAM 0-5 never rotate (split sprite, player car + hitbox)
+BULLET_GRAZED = $80             ; bullet_flags: already grazed
+SPR_BULLET_PAIR = $64           ; Two bullets 1-8 px apart (8x16 only)
+HUD_LINES   = 24                ; HUD strip height: bullets above it are killed
+
+.ifdef SPRITES_8X16
+BULLET_TILE = SPR_BULLET * 2 + 1 ; 8x16: logical tile t is OAM tile 2t+1
+.else
+BULLET_TILE = SPR_BULLET
+.endif
+
+.segment "BSS"
+
+; Kernel inputs
+_bk_xlo:     .res 1             ; Player center X - 9
+_bk_ylo:     .res 1             ; Player center Y - 9
+_bk_odd:     .res 1             ; frame_count & 1
+_bk_all:     .res 1             ; 1 = draw every bullet, 0 = parity flicker
+_bk_oam:     .res 1             ; OAM byte offset for the next bullet sprite
+_bk_step:    .res 1             ; 1 = move bullets
+_bk_collide: .res 1             ; 1 = test hit/graze (cleared after a hit)
+_bk_limit:   .res 1             ; Sprite id limit of the bullet class (spr_limit)
+; Kernel outputs
+_bk_hit:     .res 1             ; 1 = player hit this pass
+_bk_graze:   .res 1             ; 1 = new graze this pass
+_bk_pairs:   .res 1             ; Bullets stacked onto another's sprite (8x16)
+_bk_shed:    .res 1             ; Bullets due this frame that found no sprite
+
+; Working variables
+bk_i:        .res 1             ; Live list position
+bk_id:       .res 1             ; Next sprite id
+bk_bx:       .res 1             ; Current bullet X
+bk_by:       .res 1             ; Current bullet Y
+bk_dy:       .res 1             ; Y offset in graze band (0-18)
+.ifdef SPRITES_8X16
+bk_pend:     .res 1             ; OAM offset of last unstacked bullet, $FF = none
+.endif
+
+.ifdef SPRITES_8X16
+.segment "RODATA"
+
+; OAM tile for two bullets d px apart (d = 0 is a single bullet)
+pair_tile:
+    .byte BULLET_TILE
+    .byte (SPR_BULLET_PAIR+0)*2+1, (SPR_BULLET_PAIR+1)*2+1
+    .byte (SPR_BULLET_PAIR+2)*2+1, (SPR_BULLET_PAIR+3)*2+1
+    .byte (SPR_BULLET_PAIR+4)*2+1, (SPR_BULLET_PAIR+5)*2+1
+    .byte (SPR_BULLET_PAIR+6)*2+1, (SPR_BULLET_PAIR+7)*2+1
+.endif
+
+.segment "CODE"
+
+_bullet_kernel:
+    sta bk_id
+.ifdef SPRITES_8X16
+    ldx #$FF
+    stx bk_pend
+.endif
+    lda #0
+    sta bk_i
+    beq @loop                   ; Always taken
+
+@done:
+    lda bk_id
+    ldx #0
+    rts
+
+@kill:
+    ; Swap slot X with the last live entry; re-check position bk_i
+    dec _bullet_count
+    ldy _bullet_count
+    lda _bullet_slot, y
+    ldy bk_i
+    sta _bullet_slot, y
+    txa
+    ldy _bullet_count
+    sta _bullet_slot, y
+
+@loop:
+    ldy bk_i
+    cpy _bullet_count
+    bcs @done
+    ldx _bullet_slot, y         ; X = slot
+    lda _bullet_x, x
+    sta bk_bx
+    lda _bullet_y, x
+    sta bk_by
+
+    ; Move - LOD: far bullets (Y < 40 or Y > 200) move every other frame
+    lda _bk_step
+    beq @collide
+    lda _bk_odd
+    beq @move
+    lda bk_by
+    cmp #40
+    bcc @collide
+    cmp #201
+    bcs @collide
+@move:
+    ldy _bullet_vel, x          ; Y = velocity id
+    lda _bullet_xf, x           ; 8.8 add: sub-pixel carry goes into X
+    clc
+    adc _vel_dxf, y
+    sta _bullet_xf, x
+    lda bk_bx
+    adc _vel_dx, y
+    cmp #8                      ; Off the sides: X < 8 or X > 248
+    bcc @kill
+    cmp #249
+    bcs @kill
+    sta bk_bx
+    lda _bullet_yf, x
+    clc
+    adc _vel_dyf, y
+    sta _bullet_yf, x
+    lda bk_by
+    adc _vel_dy, y
+    sec                         ; Off the top/bottom: Y < HUD_LINES (under the
+    sbc #HUD_LINES              ; HUD strip) or Y > 240 (wraps)
+    cmp #241-HUD_LINES
+    bcs @kill
+    adc #HUD_LINES              ; Carry clear
+    sta bk_by
+    sta _bullet_y, x
+    lda bk_bx
+    sta _bullet_x, x
+
+@collide:
+    lda _bk_collide
+    beq @draw
+    ; Broadphase: player's vertical band |dy| < 10
+    lda bk_by
+    sec
+    sbc _bk_ylo
+    cmp #19
+    bcs @draw
+    sta bk_dy
+    ; Graze box: |dx| < 10
+    lda bk_bx
+    sec
+    sbc _bk_xlo
+    cmp #19
+    bcs @draw
+    ; Hit box: |dx| < 4 && |dy| < 4  (offset 6..12)
+    sbc #6-1                    ; Carry clear here: subtracts 6
+    cmp #7
+    bcs @graze
+    lda bk_dy
+    sbc #6-1                    ; Carry still clear (cmp failed)
+    cmp #7
+    bcs @graze
+    lda #1                      ; Hit: one per pass, stop testing
+    sta _bk_hit
+    lsr a
+    sta _bk_collide
+    jmp @kill
+@graze:
+    lda _bullet_flags, x        ; One graze per bullet
+    bmi @draw                   ; BULLET_GRAZED is bit 7
+    ora #BULLET_GRAZED
+    sta _bullet_flags, x
+    lda #1
+    sta _bk_graze
+
+@draw:
+    ; All bullets when they fit, else live positions matching frame parity
+    lda _bk_all
+    bne @drawit
+    lda bk_i
+    and #1
+    cmp _bk_odd
+    bne @next
+@drawit:
+.ifdef SPRITES_8X16
+    ; Stack onto the last bullet sprite: same column (|dx| <= 1), 0-8 px apart
+    ldy bk_pend
+    iny                         ; $FF = nothing to stack on
+    beq @single
+    dey
+    lda bk_bx
+    sec
+    sbc OAM+3, y
+    clc
+    adc #1
+    cmp #3
+    bcs @single
+    lda bk_by
+    sec
+    sbc OAM, y                  ; d = by - py
+    cmp #9
+    bcc @stack                  ; New bullet is the lower one (or level)
+    eor #$FF                    ; Carry set: A = py - by
+    adc #0
+    cmp #9
+    bcs @single
+    tax                         ; New bullet is the upper one: sprite moves up
+    lda bk_by
+    sta OAM, y
+    txa
+@stack:
+    tax
+    lda pair_tile, x
+    sta OAM+1, y
+    lda #$FF
+    sta bk_pend
+    inc _bk_pairs
+    jmp @next
+@single:
+.endif
+    lda bk_id
+    cmp _bk_limit
+    bcs @shed
+    ldy _bk_oam                 ; Rotated OAM slot (see oam_slot in main.c)
+.ifdef SPRITES_8X16
+    sty bk_pend
+.endif
+    lda bk_by
+    sta OAM, y
+    lda #BULLET_TILE
+    sta OAM+1, y
+    lda #BULLET_PAL
+    sta OAM+2, y
+    lda bk_bx
+    sta OAM+3, y
+    tya                         ; Next slot, wrapping past 63 to OAM_PINNED
+    clc
+    adc #4
+    bne @oamok
+    lda #OAM_PINNED*4
+@oamok:
+    sta _bk_oam
+    inc bk_id
+    bne @next                   ; Always taken (id <= 64)
+@shed:
+    inc _bk_shed                ; No slot left (parity-skipped bullets are not shed)
+@next:
+    inc bk_i
+    jmp @loop
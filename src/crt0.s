@@ -6,6 +6,7 @@
 
 .import _main
 .import _music_update
+.import _vram_flush
 .import initlib, donelib
 .import zerobss, copydata
 .importzp sp
@@ -13,11 +14,43 @@
 ; NMI flag - set when NMI happens, cleared by main loop
 ; Use BSS instead of ZEROPAGE to avoid overflow
 .export _nmi_flag
+; Frame handshake - the main loop sets frame_ready once OAM and the shadows
+; below are complete; the NMI uploads them and clears it. Lag frames leave
+; it clear, so the last complete frame stays on screen
+.export _frame_ready, _ppu_ctrl_shadow, _ppu_scroll_x, _ppu_scroll_y
+; HUD split - ppu_split set: the top HUD_LINES lines show the HUD nametable
+; ($2400) and the road from $2000 starts below them, switched on sprite 0 hit
+; by hud_split(). The NMI latches it with the scroll and sets up the strip
+.export _ppu_split, _ppu_mask_shadow, _hud_split
 .segment "BSS"
 _nmi_flag: .res 1
+_frame_ready: .res 1
+_ppu_ctrl_shadow: .res 1        ; Written to PPU_CTRL (NMI on, sprite size)
+_ppu_scroll_x: .res 1
+_ppu_scroll_y: .res 1
+_ppu_split: .res 1
+_ppu_mask_shadow: .res 1        ; Last PPU_MASK from ppu_on/ppu_off (0 = off)
+; Last frame shown (latched from the shadows above)
+nmi_split: .res 1
+nmi_x: .res 1
+nmi_y: .res 1
+nmi_road: .res 1                ; Road Y below the HUD strip
+nmi_lo: .res 1                  ; ... as the low PPU_ADDR byte, with coarse X
+
+; PPU registers
+PPU_CTRL   = $2000
+PPU_STATUS = $2002
+OAM_ADDR   = $2003
+PPU_SCROLL = $2005
+PPU_ADDR   = $2006
+OAM_DMA    = $4014
+
+; Must match main.c
+HUD_LINES  = 24                 ; HUD strip height, sprite 0 hits on its last line
+HIT_WAIT   = 3                  ; Sprite 0 poll timeout, x 256 polls (sprite 0 hidden)
 
 ; Stack is at top of SRAM ($0300-$07FF)
-; We'll put C stack at $0700-$0800
+; We'll put C stack at $0700-$07F8 ($07F8-$07FF holds the DEBUG counters)
 
 .segment "HEADER"
 ; iNES header (16 bytes)
@@ -80,10 +113,10 @@ reset:
     jsr zerobss
     jsr copydata
 
-; Set up C stack pointer at $0800 (top of usable RAM)
-    lda #$00
+; Set up C stack pointer at $07F8 (just below the DEBUG segment)
+    lda #$F8
     sta sp
-    lda #$08
+    lda #$07
     sta sp+1
 
 ; Initialize C library
@@ -98,7 +131,9 @@ _exit:
 @hang:
     jmp @hang
 
-; NMI handler - updates music for stable audio timing
+; NMI handler - uploads a finished frame, sets the HUD strip's scroll,
+; updates music for stable timing. The sprite 0 wait and the split writes
+; are left to the main loop (_hud_split), so the NMI never busy-waits
 nmi:
     pha                     ; Save A
     txa
@@ -110,6 +145,78 @@ nmi:
     lda #1
     sta _nmi_flag
 
+    ; Nothing to upload until the main loop has finished a frame
+    lda _frame_ready
+    beq @lag
+
+    ; Sprite DMA from the OAM buffer
+    lda #0
+    sta OAM_ADDR
+    lda #$02
+    sta OAM_DMA
+
+    ; Queued VRAM updates (before scroll: they move the PPU address)
+    jsr _vram_flush
+
+    lda _ppu_split
+    sta nmi_split
+    lda _ppu_scroll_x
+    sta nmi_x
+    lda _ppu_scroll_y
+    sta nmi_y
+    lda nmi_split
+    bne @hud
+    jsr road_scroll
+    jmp @shown
+
+    ; HUD strip from the top of $2400, unscrolled
+@hud:
+    lda _ppu_ctrl_shadow
+    ora #$01
+    sta PPU_CTRL
+    lda #0
+    sta PPU_SCROLL
+    sta PPU_SCROLL
+
+    ; Road Y at the first line below the strip: nmi_y + HUD_LINES, wrapping
+    ; at 240 like the PPU does (nmi_y is 0-239)
+    lda nmi_y
+    cmp #240-HUD_LINES
+    bcc @plain
+    sbc #240-HUD_LINES      ; Carry set
+    bcs @road_y             ; Always taken
+@plain:
+    adc #HUD_LINES          ; Carry clear
+@road_y:
+    sta nmi_road
+    and #$F8                ; Low PPU_ADDR byte: coarse Y bits 0-2, coarse X
+    asl a
+    asl a
+    sta nmi_lo
+    lda nmi_x
+    lsr a
+    lsr a
+    lsr a
+    ora nmi_lo
+    sta nmi_lo
+
+@shown:
+    lda #0
+    sta _frame_ready        ; Frame shown: main loop may build the next
+    beq @music              ; Always taken
+
+    ; Lag frame: the main loop is busy and cannot do the split, so a split
+    ; frame shows the road full screen from nmi_y (the road lines below the
+    ; strip stay where they were, the HUD drops out for one frame). Not with
+    ; rendering off: the main loop may be writing VRAM
+@lag:
+    lda nmi_split
+    beq @music
+    lda _ppu_mask_shadow
+    beq @music
+    jsr road_scroll
+
+@music:
     ; Call music update (C function)
     jsr _music_update
 
@@ -120,6 +227,65 @@ nmi:
     pla                     ; Restore A
     rti
 
+; Full-screen road scroll from the latched shadows
+road_scroll:
+    lda _ppu_ctrl_shadow
+    sta PPU_CTRL
+    lda nmi_x
+    sta PPU_SCROLL
+    lda nmi_y
+    sta PPU_SCROLL
+    rts
+
+; void hud_split(void);
+; Main loop, right after the NMI showed a frame: if it has the HUD strip,
+; wait for sprite 0 and point the PPU at the road for the rest of the screen
+_hud_split:
+    lda nmi_split
+    beq @done
+    lda _ppu_mask_shadow
+    beq @done
+
+    ; Last frame's hit flag clears on the pre-render line, before the end of
+    ; vblank. Still set after 256 polls (~2.8k cycles, longer than vblank)
+    ; means the NMI ran late and it is already this frame's hit
+    ldx #0
+@hit_clear:
+    bit PPU_STATUS
+    bvc @wait
+    dex
+    bne @hit_clear
+    beq @split              ; Always taken
+
+    ; This frame's hit. Gives up after HIT_WAIT x 256 polls
+@wait:
+    ldy #HIT_WAIT
+    ldx #0
+@hit:
+    bit PPU_STATUS
+    bvs @split
+    dex
+    bne @hit
+    dey
+    bne @hit
+@done:
+    rts
+
+    ; Sprite 0 sits under a lap mark at x = 160, so the hit comes mid-line:
+    ; the last write lands in the horizontal blank after the strip's last line
+@split:
+    nop
+    nop
+    lda #0
+    sta PPU_ADDR            ; Nametable $2000
+    lda nmi_road
+    sta PPU_SCROLL          ; Fine and coarse Y
+    lda nmi_x
+    sta PPU_SCROLL          ; Fine X
+    lda nmi_lo
+    sta PPU_ADDR            ; Coarse Y/X low bits, takes effect now
+    rts
+
 ; IRQ handler (not used)
 irq:
     rti
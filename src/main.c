@@ -67,9 +67,8 @@
 #define ROAD_LEFT       40
 #define ROAD_RIGHT      216
 #define SCREEN_HEIGHT   240
-#define HUD_TOP_Y       8
-#define HUD_LINE        8
-#define HUD_BAND_BOTTOM 0   // No restriction - enemies visible at any Y
+#define HUD_LINES       24  // Top strip from the HUD nametable, road below (crt0.s, bullets.s)
+#define HUD_BAND_BOTTOM HUD_LINES  // Nothing draws over the HUD strip
 
 // Player constants
 #define PLAYER_START_X  120
@@ -78,8 +77,11 @@
 #define PLAYER_START_HP 5
 #define PLAYER_MAX_HP   100
 
+// Score: packed BCD, 2 digits per byte, lowest byte first (src/score.s)
+#define SCORE_BYTES     6   // 12 digits, saturates at 999,999,999,999
+
 // Enemy constants
-#define ENEMY_START_Y   0    // Start from top of screen (will use 240-16 wrapped)
+#define ENEMY_START_Y   HUD_LINES  // First road line below the HUD strip
 #define SCROLL_SPEED    2
 
 // Lap distance constant
@@ -89,13 +91,18 @@
 #define TILE_ROAD       0x01
 #define TILE_GRASS      0x02
 #define TILE_LINE       0x03
+#define TILE_BAR_FILL   0x06
+#define TILE_BAR_EMPTY  0x07
+#define TILE_CAR_ICON   0x08
+#define TILE_WALL       0x0A    // Wall hazard on the road (wall layer)
+#define TILE_HEART      0x0B
+#define TILE_LAP_MARK   0x0C    // Progress bar lap boundary (sprite 0 anchor)
+#define TILE_DIGIT      0x10
+#define TILE_LETTER     0x20
 
 // Sprite tiles
 #define SPR_CAR         0x00
 #define SPR_ENEMY       0x04    // Normal enemy car
-#define SPR_SLASH       0x05
-#define SPR_BAR_FILL    0x06
-#define SPR_BAR_EMPTY   0x07
 #define SPR_CAR_ICON    0x08
 #define SPR_HLINE       0x09    // Small horizontal line marker
 #define SPR_EXPLOSION   0x0E
@@ -107,15 +114,47 @@
 #define SPR_HEART       0x4B    // Heart symbol for HP
 #define SPR_DOT         0x4C    // Dot/period for version
 #define SPR_SMOKE       0x4D    // Smoke puff for exhaust
+#define SPR_CURSOR      0x4E    // Name entry cursor (0x04-0x07 are the enemy car)
 #define SPR_BOSS        0x60    // Boss/Elite enemy car
+#define SPR_BULLET_PAIR 0x64    // 0x64-0x6B: two bullets 1-8 px apart (8x16 only)
+
+// Optional 8x16 sprite mode (make SPRITES_8X16=1). generate_chr.py --8x16
+// stores logical tile t as the pair 2t/2t+1 (glyph over blank), so callers
+// keep 8x8 tile numbers and set_sprite() remaps them. Cars become two
+// column pairs, and the bullet kernel stacks bullets into SPR_BULLET_PAIR
+#ifdef SPRITES_8X16
+#define SPR_H           16
+#define SPR_TILE(t)     (((t) << 1) | 1)  // Odd index = pattern table $1000
+#define CAR_SPRITES     2
+#define PPU_CTRL_ON     0xA8    // NMI on, 8x16 sprites
+#else
+#define SPR_H           8
+#define SPR_TILE(t)     (t)
+#define CAR_SPRITES     4
+#define PPU_CTRL_ON     0x88    // NMI on, sprites at $1000
+#endif
 
 // NMI flag from crt0.s (set by NMI handler, cleared by main loop)
 extern volatile unsigned char nmi_flag;
+// Frame handshake (crt0.s): set when OAM, the VRAM queue and shadows are
+// complete; the NMI does sprite DMA, vram_flush, PPU_CTRL and scroll, then clears it
+extern volatile unsigned char frame_ready;
+extern unsigned char ppu_ctrl_shadow;
+extern unsigned char ppu_scroll_x;
+extern unsigned char ppu_scroll_y;
+// HUD split (crt0.s): set by draw_game, whose sprite 0 marks the strip's
+// last line; the NMI shows the HUD nametable above it, and hud_split() waits
+// for the sprite 0 hit and switches to the road below it
+extern unsigned char ppu_split;
+extern void hud_split(void);
+// Shadow of PPU_MASK (last value set by ppu_on/ppu_off)
+// Anything that temporarily changes PPU_MASK restores from here
+extern unsigned char ppu_mask_shadow;
 
 // Global variables
 static unsigned char game_state;
 static unsigned char frame_count;
-static unsigned char scroll_y;
+static unsigned char scroll_y;          // Road scroll, 0-239 (the nametable height)
 static unsigned char pad_now;
 static unsigned char pad_old;
 static unsigned char pad_new;
@@ -147,8 +186,7 @@ static unsigned char explode_timer;    // Animation timer (explosion or retire)
 static unsigned char position;
 static unsigned char lap_count;
 static unsigned char loop_count;  // Current loop (2周目, 3周目...)
-static unsigned int score;        // Score lower 16 bits (0-65535)
-static unsigned int score_high;   // Score upper (increments when score overflows)
+unsigned char score[SCORE_BYTES]; // Packed BCD, score[0] = tens:ones (see src/score.s)
 static unsigned int distance;
 static unsigned int score_multiplier;  // Score multiplier (1-65535)
 static unsigned char graze_count;       // Graze counter for HP recovery (every 10)
@@ -157,19 +195,152 @@ static unsigned char boost_remaining;   // Boosts remaining this loop (max 2)
 static unsigned char boost_active;      // Currently boosting flag
 static unsigned char boss_music_active; // Is boss music currently playing?
 
+// Difficulty profile for the current loop - filled once by set_difficulty()
+// (init_game and loop clear) so hot paths don't re-derive it from loop_count
+static unsigned char diff_speed;        // Bullet speed class bonus
+static unsigned char diff_fire_down;    // Normal enemy fire interval, shooting down
+static unsigned char diff_fire_up;      // Normal enemy fire interval, shooting up
+static unsigned char diff_move_mask;    // Enemy AI steers when (frame & mask) == 0
+static unsigned char diff_score_shift;  // Graze score = multiplier << shift
+static unsigned char diff_grass_hue;    // Loop palette: grass
+static unsigned char diff_road_hue;     // Loop palette: road
+
 
 // Bullet system (danmaku)
+// Pool arrays and bullet_count are non-static: shared with src/bullets.s
+// Packed record, 7 bytes per bullet: 8.8 position, velocity id, flags, slot
+// The pool lives in cartridge WRAM (SCRATCH segment, $6100-): not cleared at
+// reset and not part of the save - clear_bullets()/spawn_bullet() set it up
+// Pool size = the most live bullets one frame can process: the kernel costs
+// about 230 cycles a bullet (11k at 48) of the ~24k the main loop has between
+// the HUD split and the next vblank. Raise it (max 255, 8-bit indexes) only as
+// far as a full pool still ends inside the frame in a CPU_METER build
 #define MAX_BULLETS 48
-static unsigned char bullet_x[MAX_BULLETS];
-static unsigned char bullet_y[MAX_BULLETS];
-static signed char bullet_dx[MAX_BULLETS];  // X velocity
-static signed char bullet_dy[MAX_BULLETS];  // Y velocity
-static unsigned char bullet_on[MAX_BULLETS];
-static unsigned char bullet_grazed[MAX_BULLETS];  // Already grazed flag (1 graze per bullet)
-static unsigned char bullet_timer;  // Timer for shooting patterns
-static unsigned char bullet_next;   // Next bullet slot (circular buffer)
+#pragma bss-name(push, "SCRATCH")
+unsigned char bullet_x[MAX_BULLETS];
+unsigned char bullet_y[MAX_BULLETS];
+unsigned char bullet_xf[MAX_BULLETS];    // X sub-pixel
+unsigned char bullet_yf[MAX_BULLETS];    // Y sub-pixel
+unsigned char bullet_vel[MAX_BULLETS];   // Velocity id: (speed class << 6) | direction
+unsigned char bullet_flags[MAX_BULLETS]; // BULLET_* flags (bits 0-6 free for bullet type)
+// Slot list: bullet_slot[0..bullet_count-1] are live slots, the rest are free
+// Spawn takes bullet_slot[bullet_count], kill swaps with the last live entry
+unsigned char bullet_slot[MAX_BULLETS];
+#pragma bss-name(pop)
+#define BULLET_GRAZED 0x80  // Already grazed (1 graze per bullet)
+unsigned char bullet_count;         // Number of live bullets
+static unsigned char bullet_next;   // Live list position to overwrite when pool is full
+static unsigned char bullet_step;   // update_game() armed this frame's bullet pass to move
+static unsigned char bullet_collide; // ...and to test hits (player not invincible)
+static unsigned char bullet_hit;     // The pass hit the player: update_game() applies it
+static unsigned char bullet_graze;   // ...or grazed a new bullet
 static unsigned char burst_phase;   // 0-79 counter (avoids % 80 division)
 
+// Wall layer: slow hazards drawn as road nametable tiles instead of sprites,
+// so they cost no OAM. They ride the road scroll; one bit per road cell
+// (rows 0-29, columns 5-26) in a WRAM bitmap, 4 bytes per row
+#define WALL_COL_FIRST  5
+#define WALL_COLS       22
+#define WALL_QUEUE      4   // Rows waiting for a nametable flush
+#pragma bss-name(push, "SCRATCH")
+static unsigned char wall_map[30 * 4];
+#pragma bss-name(pop)
+static unsigned char wall_row;        // Hidden row under the HUD strip, $FF = unknown
+static unsigned char wall_pend_col;   // Wall waiting for the next hidden row:
+static unsigned char wall_pend_n;     // first column, width (0 = none)
+static unsigned char wall_queue[WALL_QUEUE];
+static unsigned char wall_queue_len;
+static unsigned char road_clear_row;  // Next row clear_center_line() rewrites, 30 = done
+
+// Bullet kernel (src/bullets.s) - one fused move/collide/draw pass
+// Inputs and outputs live in bullets.s so the C reference shares them
+extern unsigned char bk_xlo;      // Player center X - 9 (left of graze box)
+extern unsigned char bk_ylo;      // Player center Y - 9 (top of graze band)
+extern unsigned char bk_odd;      // frame_count & 1 (LOD and flicker parity)
+extern unsigned char bk_all;      // 1 = draw every bullet, 0 = parity flicker (overflow)
+extern unsigned char bk_oam;      // OAM byte offset of the first bullet sprite
+extern unsigned char bk_step;     // 1 = move bullets this pass
+extern unsigned char bk_collide;  // 1 = test player hit/graze
+extern unsigned char bk_limit;    // Sprite id limit of the bullet class (spr_limit)
+extern unsigned char bk_hit;      // Out: player hit (that bullet is removed)
+extern unsigned char bk_graze;    // Out: at least one new graze
+extern unsigned char bk_pairs;    // Out: bullets stacked onto another's sprite (8x16)
+extern unsigned char bk_shed;     // Out: bullets due this frame that found no sprite
+unsigned char __fastcall__ bullet_kernel(unsigned char id);
+
+// VRAM update queue (src/vram.s) - filled during the frame by vram_run() /
+// vram_fill(), written by the NMI with the frame. Bounded by bytes and by
+// PPU writes, so a full queue always fits the vblank next to sprite DMA
+#define VRAM_BUF_SIZE  96      // Must match vram.s
+#define VRAM_BUDGET    80      // PPU writes per vblank
+#define VRAM_DOWN      0x4000  // Address flag: +32 increment (down a column)
+#define VRAM_FILL      0x8000  // Address flag: one byte repeated
+extern unsigned char vram_buf[VRAM_BUF_SIZE];
+extern unsigned char vram_len;   // Bytes queued
+extern unsigned char vram_cost;  // PPU writes queued
+void __fastcall__ vram_flush(void);
+void __fastcall__ vram_unrle(const unsigned char *data);  // Rendering off only
+
+// OAM writers (src/oam.s) - see draw_template() and draw_meta()
+extern const unsigned char *oam_src;  // Template: n OAM records (Y, tile, attr, X)
+extern unsigned char oam_n;           // Sprites to copy / out: metasprite records shed
+extern unsigned char oam_mx;          // Metasprite position
+extern unsigned char oam_my;
+extern unsigned char oam_attr;        // ORed into each record's attribute
+extern unsigned char oam_off;         // OAM byte offset of the first sprite
+extern unsigned char oam_lim;         // Sprite id limit (spr_limit)
+unsigned char __fastcall__ oam_blit(unsigned char id);
+unsigned char __fastcall__ oam_meta(unsigned char id);
+
+// Score arithmetic (src/score.s) - see add_score()
+extern unsigned char sc_times;    // Binary factor applied to the points
+extern unsigned char sc_shift;    // Then doubled this many times
+void __fastcall__ score_add(unsigned int points);
+
+// Lookup tables (build/tables.s, generated by tools/generate_tables.py)
+// Directions are 0-63: 0 = right, 16 = down, 32 = left, 48 = up
+// Velocity id = (speed class << 6) | direction, classes 0-3 = 2/3/4/5 px/frame
+extern const unsigned char vel_dxf[256];  // X velocity sub-pixel
+extern const signed char vel_dx[256];     // X velocity whole pixels
+extern const unsigned char vel_dyf[256];  // Y velocity sub-pixel
+extern const signed char vel_dy[256];     // Y velocity whole pixels
+extern const unsigned char atan_tab[256]; // [(ay << 4) | ax] -> direction 0-16
+extern const unsigned char pal_bright_tab[9 * 64];  // [level * 64 + color], level 4 = as is
+
+// Road screens (build/nametables.s, generated by tools/generate_nametables.py)
+// RLE-packed nametable + attributes for vram_unrle
+extern const unsigned char nt_race[];   // Dashed center line
+extern const unsigned char nt_title[];  // Plain road
+extern const unsigned char nt_hud[];    // HUD strip frame ($2400)
+
+// OAM scheduler: the HUD split sprite, player car and hitbox are pinned to
+// OAM 0-5, every other sprite is rotated through OAM 6-63 by a different
+// amount each frame so the 8-sprites-per-scanline dropout turns into flicker
+// across all of them
+#define OAM_PINNED    6
+#define OAM_DYNAMIC   (64 - OAM_PINNED)
+#define OAM_ROT_STEP  23  // Slots per frame (coprime to OAM_DYNAMIC = 58)
+static unsigned char oam_rot;        // Rotation in effect (set only inside draw_game)
+static unsigned char oam_rot_frame;  // This frame's rotation
+static unsigned char oam_hw;         // Sprite id the last OAM build ended at
+static unsigned char oam_hw_rot;     // ... and the rotation it used
+
+// Sprite budget: draw_game emits sprite classes in priority order and each
+// class may use at most its budget; lower classes get whatever is left.
+// set_sprite drops (and counts) ids at or past spr_limit
+#define SPR_CLASS_CRITICAL   0  // Split sprite, player car + hitbox (pinned OAM 0-5)
+#define SPR_CLASS_CARS       1  // Enemy cars + rank digits
+#define SPR_CLASS_HUD        2  // Warning, lag readout (the rest is background)
+#define SPR_CLASS_BULLETS    3  // Danmaku (bullet_pass)
+#define SPR_CLASS_PARTICLES  4  // Explosion
+static const unsigned char spr_budget[5] = {
+    OAM_PINNED,            // Critical
+    MAX_ENEMIES * (CAR_SPRITES + 2),  // Cars: car + 2 rank digit sprites each
+    8,                     // HUD: warning + 7 for the lag readout
+    64, 64                 // Bullets, particles: the rest
+};
+static unsigned char spr_limit;      // First sprite id the current class may not use
+
 static unsigned char rnd_seed;
 static unsigned char win_timer;  // Animation timer for win screen
 static unsigned char loop_clear_timer;  // Timer for loop clear celebration
@@ -184,17 +355,18 @@ static unsigned char confetti_color[MAX_CONFETTI];
 // HIGH SCORE SYSTEM (Battery-backed SRAM)
 // ============================================
 
-#define SAVE_MAGIC 0x52  // 'R' for Race - validates save data
+#define SAVE_MAGIC 0x53  // Validates save data (0x52 = old 32-bit binary scores)
 #define NUM_HIGH_SCORES 3
 
-// Save data structure in battery-backed SRAM ($6000-$7FFF)
+// Save data structure in battery-backed SRAM ($6000-$60FF, SAVE segment)
+// $6100-$7FFF is scratch WRAM (SCRATCH segment) - never written here
 // Use volatile to ensure compiler doesn't optimize away SRAM writes
 #pragma bss-name(push, "SAVE")
 static volatile unsigned char save_magic;           // Magic byte to validate save
-static volatile unsigned int  high_scores[NUM_HIGH_SCORES];      // Top 3 scores (low 16-bit)
-static volatile unsigned int  high_scores_high[NUM_HIGH_SCORES]; // Top 3 scores (high 16-bit)
+static volatile unsigned char high_scores[NUM_HIGH_SCORES][SCORE_BYTES]; // Top 3 scores (packed BCD)
 static volatile unsigned char high_names[NUM_HIGH_SCORES][3];    // 3-letter names
 static volatile unsigned char max_loop;             // Maximum loop reached (for loop select)
+static volatile unsigned char save_probe;           // SRAM test byte (init_save)
 #pragma bss-name(pop)
 
 // Name entry state
@@ -206,6 +378,52 @@ static unsigned char new_score_rank;     // Which rank the new score achieved (0
 // Title screen loop selection
 static unsigned char title_select_loop;  // Selected starting loop (0-based)
 
+// Title leaderboard as finished OAM records (rank, name, score per entry),
+// built once by build_title_board() and block-copied every title frame
+#define TITLE_BOARD_MAX (NUM_HIGH_SCORES * 10)  // 4 + up to 6 sprites each
+#pragma bss-name(push, "SCRATCH")
+static unsigned char title_board[TITLE_BOARD_MAX * 4];
+#pragma bss-name(pop)
+static unsigned char title_board_n;      // Sprites in title_board, 0 = rebuild
+
+// Lag-frame and sprite-shed counters at a fixed address ($07F8-$07FD)
+// for debugging/TAS. A lag frame is one where the NMI fired before the
+// frame was finished; shed sprites are ones draw_game had no budget for
+#pragma bss-name(push, "DEBUG")
+static unsigned int  lag_frames;         // Lag frames this race
+static unsigned char lag_streak;         // Current run of consecutive lag frames
+static unsigned char lag_worst;          // Worst lag streak this race
+static unsigned char spr_shed;           // Sprites dropped by the budget last frame
+static unsigned char spr_shed_worst;     // Most sprites dropped in one frame this race
+#pragma bss-name(pop)
+static unsigned char debug_hud;          // SELECT toggles lag readout in HUD
+
+// HUD strip: background tiles in the HUD nametable (nt_hud), rewritten
+// through the VRAM queue by hud_update() only when the value behind them
+// changes. A field stays dirty until the queue takes it
+#define HUD_NT(row, col)  (0x2400 + (row) * 32 + (col))
+#define HUD_ROW_TEXT  1   // Must match tools/generate_nametables.py
+#define HUD_ROW_BAR   2
+#define HUD_HP_COL    4   // 2 digits after the heart
+#define HUD_LOOP_COL  8   // "L" + loop number (blank on loop 1)
+#define HUD_MULT_COL  19  // 4 digits (or XXE#) after the "x"
+#define HUD_SCORE_COL 25  // 4 digits (or XXE#)
+#define HUD_BAR_COL   3   // 3 laps of 8 cells with a lap mark between
+#define HUD_BAR_CELLS 24
+#define HUD_SPR0_X    160 // Sprite 0 under the second lap mark (column 20)
+#define HUD_HP        0x01  // hud_dirty bits
+#define HUD_LOOP      0x02
+#define HUD_MULT      0x04
+#define HUD_SCORE     0x08
+#define HUD_BAR       0x10
+#define HUD_ALL       0x1F
+static unsigned char hud_dirty;          // Fields not yet queued
+static unsigned char hud_hp;             // Values the strip shows
+static unsigned char hud_loop;
+static unsigned int  hud_mult;
+static unsigned char hud_score[SCORE_BYTES];
+static unsigned char hud_bar;            // Progress cell of the car icon
+
 // ============================================
 // MUSIC ENGINE
 // ============================================
@@ -598,8 +816,8 @@ const unsigned char palette[32] = {
     // BG palettes
     0x0F, 0x00, 0x10, 0x30,  // Road (gray)
     0x0F, 0x09, 0x19, 0x29,  // Grass (green)
-    0x0F, 0x01, 0x21, 0x31,  // Blue
-    0x0F, 0x16, 0x27, 0x37,  // Red
+    0x0F, 0x30, 0x10, 0x21,  // HUD (white, blue bar fill)
+    0x0F, 0x16, 0x27, 0x37,  // HUD heart (red)
     // Sprite palettes
     0x0F, 0x11, 0x21, 0x31,  // Palette 0: Player (blue)
     0x0F, 0x06, 0x16, 0x26,  // Palette 1: Enemy (red)
@@ -613,15 +831,16 @@ const unsigned char palette[32] = {
 static void do_game_over(void);
 static void do_finish_lose(void);
 static void finish_game_over(void);
-static unsigned char check_high_score(unsigned int new_score_high, unsigned int new_score_low);
-static void insert_high_score(unsigned char rank, unsigned int new_score_high, unsigned int new_score_low);
+static unsigned char check_high_score(void);
+static void insert_high_score(unsigned char rank);
 static void init_name_entry(unsigned char rank);
 static void music_play(unsigned char track);
 static void music_stop(void);
 static void update_loop_palette(void);
-static unsigned char score_greater(unsigned int a_high, unsigned int a_low,
-                                    unsigned int b_high, unsigned int b_low);
+static unsigned char score_greater(const volatile unsigned char *a,
+                                   const volatile unsigned char *b);
 static void validate_high_scores(void);
+static void start_enemy_pattern(unsigned char slot);
 
 // ============================================
 // MUSIC FUNCTIONS
@@ -1027,25 +1246,74 @@ void music_update(void) {
 // NMI enabled flag (set after PPU_CTRL enables NMI)
 static unsigned char nmi_enabled;
 
+// CPU usage meter (debug build: make CPU_METER=1)
+// Frame work runs with grayscale on; the gray band shows CPU time used
+#ifdef CPU_METER
+#define CPU_METER_BITS  0x01  // PPU_MASK grayscale
+#define cpu_meter_on()  (PPU_MASK = ppu_mask_shadow | CPU_METER_BITS)
+#define cpu_meter_off() (PPU_MASK = ppu_mask_shadow)
+#else
+#define cpu_meter_on()
+#define cpu_meter_off()
+#endif
+
 // Wait for vblank using NMI flag (more reliable than PPU_STATUS)
 static void wait_vblank(void) {
+    cpu_meter_off();  // Idle time is not part of the meter band
     if (nmi_enabled) {
         // Clear flag FIRST to ensure we wait for the *next* VBlank
         nmi_flag = 0;
         while (!nmi_flag);
+        // Consume it: if set again before the next wait, the frame overran
+        nmi_flag = 0;
     } else {
         // Fallback for early init before NMI is enabled
         while (!(PPU_STATUS & 0x80));
     }
 }
 
+// End of frame: hand the finished OAM buffer and scroll to the NMI, then
+// wait for it to upload them. A long frame misses the vblank but the NMI
+// keeps showing the last finished one instead of a half-built buffer.
+// Then the split for the frame now showing, before the next frame's work
+static void present_frame(void) {
+    cpu_meter_off();
+    ppu_scroll_y = scroll_y;
+    frame_ready = 1;
+    while (frame_ready);
+    nmi_flag = 0;  // Consumed: set again before the next present = overrun
+    hud_split();
+}
+
+// Reset lag counters (start of each race)
+static void reset_lag_stats(void) {
+    lag_frames = 0;
+    lag_streak = 0;
+    lag_worst = 0;
+    spr_shed_worst = 0;
+}
+
+// Count a lag frame (call just before the main loop's present_frame)
+// nmi_flag already set means the vblank passed while we were still working
+static void count_lag(void) {
+    if (nmi_flag) {
+        if (lag_frames < 65535u) ++lag_frames;
+        if (lag_streak < 255) ++lag_streak;
+        if (lag_streak > lag_worst) lag_worst = lag_streak;
+    } else {
+        lag_streak = 0;
+    }
+}
+
 // Turn off PPU
 static void ppu_off(void) {
+    ppu_mask_shadow = 0x00;
     PPU_MASK = 0x00;
 }
 
 // Turn on PPU (sprites and background)
 static void ppu_on(void) {
+    ppu_mask_shadow = 0x1E;
     PPU_MASK = 0x1E;
 }
 
@@ -1057,13 +1325,128 @@ static void ppu_addr(unsigned int addr) {
     PPU_ADDR = (unsigned char)(addr);
 }
 
-// Add points to score with overflow handling
-static void add_score(unsigned int points) {
-    unsigned int old_score = score;
-    score += points;
-    // Check for overflow (new score is less than old score)
-    if (score < old_score) {
-        ++score_high;
+// Queue an entry of n PPU writes taking size data bytes; returns where the
+// data goes, or 0 when this vblank is full. With rendering off the queue is
+// written out at once instead, so blanked redraws never fail
+static unsigned char *vram_entry(unsigned int addr, unsigned char n, unsigned char size) {
+    unsigned char *p;
+    if (vram_len + 3 + size > VRAM_BUF_SIZE || vram_cost + n > VRAM_BUDGET) {
+        if (ppu_mask_shadow) return 0;
+        vram_flush();
+    }
+    p = vram_buf + vram_len;
+    p[0] = (unsigned char)(addr >> 8);
+    p[1] = (unsigned char)addr;
+    p[2] = n;
+    vram_len += 3 + size;
+    vram_cost += n;
+    return p + 3;
+}
+
+// Queue n bytes for addr (| VRAM_DOWN for a column; n = 1 for a single
+// byte): returns where to put them, 0 = wait for the next vblank
+static unsigned char *vram_run(unsigned int addr, unsigned char n) {
+    return vram_entry(addr, n, n);
+}
+
+// Queue n copies of value at addr (| VRAM_DOWN): 0 = wait for the next vblank
+static unsigned char vram_fill(unsigned int addr, unsigned char n, unsigned char value) {
+    unsigned char *p = vram_entry(addr | VRAM_FILL, n, 1);
+    if (!p) return 0;
+    *p = value;
+    return 1;
+}
+
+// ============================================
+// PALETTE (shadow copy, brightness and fades)
+// ============================================
+// Game code edits pal_buf; pal_update() queues all 32 entries through
+// pal_bright_tab only when something changed, and the NMI writes them
+// with the frame. Brightness 0 = black, PAL_NORMAL = as is, 8 = white
+
+#define PAL_NORMAL  4
+
+static unsigned char pal_buf[32];      // Shadow palette at normal brightness
+static unsigned char pal_bright;       // Brightness shown (0-8)
+static unsigned char pal_fade_to;      // Brightness a fade is heading for
+static unsigned char pal_fade_rate;    // Frames per fade step
+static unsigned char pal_fade_timer;   // Frames until the next step
+static unsigned char pal_dirty;        // pal_buf or pal_bright changed
+
+// Set brightness at once (stops a fade)
+static void pal_set_bright(unsigned char level) {
+    pal_bright = level;
+    pal_fade_to = level;
+    pal_dirty = 1;
+}
+
+// Fade one brightness step every rate (>= 1) frames until level is reached
+static void pal_fade(unsigned char level, unsigned char rate) {
+    pal_fade_to = level;
+    pal_fade_rate = rate;
+    pal_fade_timer = rate;
+}
+
+// Queue the palette at the current brightness if it changed
+// (waits a frame if the VRAM queue is full)
+static void pal_upload(void) {
+    unsigned char i;
+    unsigned char *p;
+    const unsigned char *tab;
+
+    if (!pal_dirty) return;
+    p = vram_run(0x3F00, 32);
+    if (!p) return;
+    tab = pal_bright_tab + pal_bright * 64;
+    for (i = 0; i < 32; ++i) {
+        p[i] = tab[pal_buf[i]];
+    }
+    pal_dirty = 0;
+}
+
+// Once per frame: step a fade, then upload
+static void pal_update(void) {
+    if (pal_bright != pal_fade_to && --pal_fade_timer == 0) {
+        pal_fade_timer = pal_fade_rate;
+        if (pal_bright < pal_fade_to) ++pal_bright; else --pal_bright;
+        pal_dirty = 1;
+    }
+    pal_upload();
+}
+
+// Add points * times * 2^shift to the BCD score (saturates, never wraps)
+// Callers pass the factors instead of a product that would overflow 16 bits
+static void add_score(unsigned int points, unsigned char times, unsigned char shift) {
+    sc_times = times;
+    sc_shift = shift;
+    score_add(points);
+}
+
+// Score digit n (0 = ones) of a packed BCD score
+static unsigned char score_digit(const volatile unsigned char *bcd, unsigned char n) {
+    unsigned char b = bcd[n >> 1];
+    return (n & 1) ? (b >> 4) : (b & 0x0F);
+}
+
+// Index of the highest non-zero digit (0 for a zero score)
+static unsigned char score_top(const volatile unsigned char *bcd) {
+    unsigned char i = SCORE_BYTES - 1;
+    while (i && bcd[i] == 0) --i;
+    return (bcd[i] & 0xF0) ? (i << 1) + 1 : (i << 1);
+}
+
+// Damage penalty: score - 1, stopping at zero
+static void score_dec(void) {
+    unsigned char i;
+    if (score_top(score) == 0 && score[0] == 0) return;  // Already zero
+    for (i = 0; i < SCORE_BYTES; ++i) {
+        if (score[i] == 0) {
+            score[i] = 0x99;             // Borrow from the next byte
+        } else {
+            if (score[i] & 0x0F) --score[i];
+            else score[i] -= 7;          // x0 -> (x-1)9
+            return;
+        }
     }
 }
 
@@ -1095,150 +1478,268 @@ static unsigned char rnd(void) {
 // Forward declaration
 static void init_win_animation(void);
 
-// Clear all sprites (move offscreen)
-static void clear_sprites(void) {
-    unsigned char i;
-    for (i = 0; i < 64; ++i) {
+// OAM slot for sprite id - draw_game rotates everything above the pinned
+// sprites by oam_rot slots (wrapping back to OAM_PINNED); 0 = no rotation
+static unsigned char oam_slot(unsigned char id) {
+    if (id >= OAM_PINNED) {
+        id += oam_rot;
+        if (id >= 64) id -= OAM_DYNAMIC;
+    }
+    return id;
+}
+
+// Start a sprite class at id: it may use up to spr_budget[cls] sprites
+static void spr_class(unsigned char id, unsigned char cls) {
+    id += spr_budget[cls];
+    spr_limit = id > 64 ? 64 : id;
+}
+
+// End this frame's OAM build at sprite id. Only sprites the last build drew
+// past id are hidden: last frame's dynamic run, seen from this frame's
+// rotation, starts d ids past OAM_PINNED and may wrap once around
+static void hide_rest(unsigned char id) {
+    unsigned char i, end, used, d;
+
+    // Pinned ids map straight to OAM 0-5
+    end = oam_hw < OAM_PINNED ? oam_hw : OAM_PINNED;
+    for (i = id; i < end; ++i) {
         OAM[i * 4] = 0xFF;
     }
+
+    if (oam_hw > OAM_PINNED) {
+        used = id > OAM_PINNED ? id - OAM_PINNED : 0;
+        d = oam_hw_rot + OAM_DYNAMIC - oam_rot;
+        if (d >= OAM_DYNAMIC) d -= OAM_DYNAMIC;
+        end = d + (oam_hw - OAM_PINNED);
+        for (i = d > used ? d : used; i < end && i < OAM_DYNAMIC; ++i) {
+            OAM[oam_slot(OAM_PINNED + i) * 4] = 0xFF;
+        }
+        if (end > OAM_DYNAMIC) {
+            end -= OAM_DYNAMIC;
+            for (i = used; i < end; ++i) {
+                OAM[oam_slot(OAM_PINNED + i) * 4] = 0xFF;
+            }
+        }
+    }
+    oam_hw = id;
+    oam_hw_rot = oam_rot;
 }
 
-// Set a single sprite (with overflow guard)
+// Set a single sprite (with budget/overflow guard)
 static unsigned char set_sprite(unsigned char id, unsigned char x, unsigned char y,
                                 unsigned char tile, unsigned char attr) {
     unsigned int idx;
-    // Guard against OAM overflow (NES has 64 sprites max)
-    if (id >= 64) return id;
-    idx = id * 4;
+    // Over the class budget (or past OAM's 64 sprites): shed it
+    if (id >= spr_limit) {
+        ++spr_shed;
+        return id;
+    }
+    idx = oam_slot(id) * 4;
     OAM[idx] = y;
-    OAM[idx + 1] = tile;
+    OAM[idx + 1] = SPR_TILE(tile);
     OAM[idx + 2] = attr;
     OAM[idx + 3] = x;
     return id + 1;
 }
 
-// Set a 16x16 metasprite (4 sprites)
-static unsigned char set_car(unsigned char id, unsigned char x, unsigned char y,
-                             unsigned char tile_base, unsigned char attr) {
-    id = set_sprite(id, x,     y,     tile_base,     attr);
-    id = set_sprite(id, x + 8, y,     tile_base + 1, attr);
-    id = set_sprite(id, x,     y + 8, tile_base + 2, attr);
-    id = set_sprite(id, x + 8, y + 8, tile_base + 3, attr);
+// Metasprites: ROM records (dy, tile, attr, dx) relative to the draw
+// position, OAM byte order, ended by META_END. draw_meta() ORs a palette or
+// flip into every record, so one shape serves every color
+#define META_SPR(dx, dy, tile, attr)  (unsigned char)(dy), SPR_TILE(tile), (attr), (unsigned char)(dx)
+#define META_END                      0x80
+
+// 16x16 car (CAR_SPRITES sprites)
+#ifdef SPRITES_8X16
+#define META_CAR(t)  META_SPR(0, 0, (t),     0),  /* Left column pair */  \
+                     META_SPR(8, 0, (t) + 1, 0),  /* Right column pair */ \
+                     META_END
+#else
+#define META_CAR(t)  META_SPR(0, 0, (t),     0), META_SPR(8, 0, (t) + 1, 0), \
+                     META_SPR(0, 8, (t) + 2, 0), META_SPR(8, 8, (t) + 3, 0), \
+                     META_END
+#endif
+static const unsigned char ms_car[]   = { META_CAR(SPR_CAR) };
+static const unsigned char ms_enemy[] = { META_CAR(SPR_ENEMY) };
+static const unsigned char ms_boss[]  = { META_CAR(SPR_BOSS) };
+
+// Explosion around a car at (x, y): center, then a ring every 8 frames
+#define EXPLODE_CORE   META_SPR(4,  4,  SPR_EXPLOSION, 0)
+#define EXPLODE_RING1  META_SPR(-4, -4, SPR_EXPLOSION, 0), META_SPR(12, -4, SPR_EXPLOSION, 0)
+#define EXPLODE_RING2  META_SPR(-8, 4,  SPR_EXPLOSION, 0), META_SPR(16, 4,  SPR_EXPLOSION, 0)
+#define EXPLODE_RING3  META_SPR(-4, 12, SPR_EXPLOSION, 0), META_SPR(12, 12, SPR_EXPLOSION, 0)
+static const unsigned char ms_explode0[] = { EXPLODE_CORE, META_END };
+static const unsigned char ms_explode1[] = { EXPLODE_CORE, EXPLODE_RING1, META_END };
+static const unsigned char ms_explode2[] = { EXPLODE_CORE, EXPLODE_RING1, EXPLODE_RING2, META_END };
+static const unsigned char ms_explode3[] = { EXPLODE_CORE, EXPLODE_RING1, EXPLODE_RING2,
+                                             EXPLODE_RING3, META_END };
+static const unsigned char * const ms_explode[4] = {
+    ms_explode0, ms_explode1, ms_explode2, ms_explode3
+};
+
+// Draw metasprite ms at (x, y) from sprite id, attr ORed into each record
+// Rotated slots and the class budget work as in set_sprite(); records past
+// spr_limit count toward spr_shed. Returns next free sprite id
+static unsigned char draw_meta(unsigned char id, unsigned char x, unsigned char y,
+                               const unsigned char *ms, unsigned char attr) {
+    oam_src = ms;
+    oam_mx = x;
+    oam_my = y;
+    oam_attr = attr;
+    oam_off = oam_slot(id) << 2;
+    oam_lim = spr_limit;
+    id = oam_meta(id);
+    spr_shed += oam_n;
     return id;
 }
 
-// Load palettes
+// Copy a ROM template of n finished sprites to OAM at id (plain OAM order)
+static unsigned char draw_template(unsigned char id, const unsigned char *tpl, unsigned char n) {
+    oam_src = tpl;
+    oam_n = n;
+    return oam_blit(id);
+}
+
+// Draw digits n-1 .. 0 of a BCD score left to right, 8 px apart
+static unsigned char draw_score_digits(unsigned char id, unsigned char x, unsigned char y,
+                                       const volatile unsigned char *bcd, unsigned char n) {
+    while (n) {
+        --n;
+        id = set_sprite(id, x, y, SPR_DIGIT + score_digit(bcd, n), 3);
+        x += 8;
+    }
+    return id;
+}
+
+// Current score as 5 digits, 99999 when it has more
+static unsigned char draw_score5(unsigned char id, unsigned char x, unsigned char y) {
+    static const unsigned char nines[3] = {0x99, 0x99, 0x99};
+    return draw_score_digits(id, x, y, score_top(score) >= 5 ? nines : score, 5);
+}
+
+// Load palettes (into the shadow; uploaded by pal_update)
 static void load_palettes(void) {
     unsigned char i;
-    ppu_addr(0x3F00);
     for (i = 0; i < 32; ++i) {
-        PPU_DATA = palette[i];
+        pal_buf[i] = palette[i];
     }
+    pal_dirty = 1;
 }
 
-// Update background palette for different loops
-// Loop 1: Day, Loop 2: Evening, Loop 3+: Night, then alternate
-// This function should be called while PPU is OFF (during draw_road)
-static void update_loop_palette(void) {
-    unsigned char grass_hue, road_hue;
+// Fill the difficulty profile from loop_count
+// Call whenever loop_count changes (init_game, loop clear)
+static void set_difficulty(void) {
+    // Bullets: +1 speed class (pixel/frame) for every 3 loops
+    diff_speed = loop_count / 3;
 
-    // Select hue based on loop_count
-    if (loop_count == 0) {
-        grass_hue = 0x09;  // Green (day)
-        road_hue = 0x00;   // Gray
-    } else if ((loop_count & 1) == 1) {
-        grass_hue = 0x17;  // Yellow-orange (evening)
-        road_hue = 0x07;   // Orange-brown
+    // Normal enemy fire interval: faster in later loops, slower when shooting up
+    if (loop_count >= 3) {
+        diff_fire_down = 8;
+        diff_fire_up = 16;
+    } else if (loop_count >= 2) {
+        diff_fire_down = 16;
+        diff_fire_up = 32;
     } else {
-        grass_hue = 0x01;  // Blue (night)
-        road_hue = 0x00;   // Gray-blue
+        diff_fire_down = 16;
+        diff_fire_up = 16;
     }
 
-    // Write road palette (BG palette 0 at $3F00-$3F03)
-    ppu_addr(0x3F00);
-    PPU_DATA = 0x0F;              // Background color (black)
-    PPU_DATA = road_hue;          // Dark
-    PPU_DATA = road_hue + 0x10;   // Medium
-    PPU_DATA = road_hue + 0x20;   // Light
+    // Enemy AI movement frequency: loop0=8frames, loop1=4frames, loop2+=2frames
+    switch (loop_count) {
+        case 0:  diff_move_mask = 0x07; break;
+        case 1:  diff_move_mask = 0x03; break;
+        default: diff_move_mask = 0x01; break;
+    }
 
-    // Write grass palette (BG palette 1 at $3F04-$3F07)
-    ppu_addr(0x3F04);
-    PPU_DATA = 0x0F;              // Background color (black)
-    PPU_DATA = grass_hue;         // Dark
-    PPU_DATA = grass_hue + 0x10;  // Medium
-    PPU_DATA = grass_hue + 0x20;  // Light
+    // Graze score doubles each loop (up to 2^15)
+    diff_score_shift = (loop_count < 15) ? loop_count : 15;
 
-    // Reset PPU address latch and scroll after palette writes
-    (void)PPU_STATUS;
-    PPU_SCROLL = 0;
-    PPU_SCROLL = 0;
+    // Loop 1: Day, Loop 2: Evening, Loop 3+: Night, then alternate
+    if (loop_count == 0) {
+        diff_grass_hue = 0x09;  // Green (day)
+        diff_road_hue = 0x00;   // Gray
+    } else if ((loop_count & 1) == 1) {
+        diff_grass_hue = 0x17;  // Yellow-orange (evening)
+        diff_road_hue = 0x07;   // Orange-brown
+    } else {
+        diff_grass_hue = 0x01;  // Blue (night)
+        diff_road_hue = 0x00;   // Gray-blue
+    }
 }
 
-// Draw the road background
-// ROAD_LEFT=40 (tile 5), ROAD_RIGHT=216 (tile 27)
-static void draw_road(void) {
-    unsigned char row, col;
-    unsigned char attr_row;
-
+// Update background palette for different loops (hues from set_difficulty)
+static void update_loop_palette(void) {
+    // Road palette (BG palette 0 at $3F00-$3F03)
+    pal_buf[0] = 0x0F;                   // Background color (black)
+    pal_buf[1] = diff_road_hue;          // Dark
+    pal_buf[2] = diff_road_hue + 0x10;   // Medium
+    pal_buf[3] = diff_road_hue + 0x20;   // Light
+
+    // Grass palette (BG palette 1 at $3F04-$3F07)
+    pal_buf[4] = 0x0F;                   // Background color (black)
+    pal_buf[5] = diff_grass_hue;         // Dark
+    pal_buf[6] = diff_grass_hue + 0x10;  // Medium
+    pal_buf[7] = diff_grass_hue + 0x20;  // Light
+    pal_dirty = 1;
+}
+
+// Road nametable tile at (row, col) - restores wall cells
+// ROAD_LEFT=40 (tile 5), ROAD_RIGHT=216 (tile 27); must match nt_race
+// (tools/generate_nametables.py)
+static unsigned char road_tile(unsigned char row, unsigned char col) {
+    if (col < 5 || col >= 27) return TILE_GRASS;           // Grass on sides
+    if (col == 15 || col == 16) {
+        return ((row & 1) == 0) ? TILE_LINE : TILE_ROAD;   // Center line (dashed)
+    }
+    return TILE_ROAD;
+}
+
+// Draw a whole road screen (nt_race or nt_title) with rendering off
+// Unpacks the RLE nametable + attributes straight into PPU_DATA
+static void draw_road(const unsigned char *nt) {
     // Wait for VBlank before turning off PPU to avoid mid-frame glitch
     wait_vblank();
     ppu_off();
 
-    // Draw nametable (30 rows x 32 columns)
-    // Road spans tiles 5-26, grass is 0-4 and 27-31
-    for (row = 0; row < 30; ++row) {
-        ppu_addr(0x2000 + (unsigned int)row * 32);
-        for (col = 0; col < 32; ++col) {
-            if (col < 5 || col >= 27) {
-                // Grass on sides
-                PPU_DATA = TILE_GRASS;
-            } else if (col == 15 || col == 16) {
-                // Center line (dashed)
-                PPU_DATA = ((row & 1) == 0) ? TILE_LINE : TILE_ROAD;
-            } else {
-                // Road
-                PPU_DATA = TILE_ROAD;
-            }
-        }
-    }
+    // Queued updates first (palette, wall rows); the redraw replaces the rows
+    pal_upload();
+    vram_flush();
+    road_clear_row = 30;
 
-    // Attribute table (at $23C0)
-    // Each byte controls 4x4 tiles (32x32 pixels)
-    // Palette 0 = road (gray), Palette 1 = grass (green)
-    // Road is tiles 5-26, grass is 0-4 and 27-31
-    ppu_addr(0x23C0);
-    for (attr_row = 0; attr_row < 8; ++attr_row) {
-        // 0x55 = all grass, 0x00 = all road
-        // 0x05 = left half grass, right half road
-        // 0x50 = left half road, right half grass
-        PPU_DATA = 0x55;  // Columns 0-3: grass
-        PPU_DATA = 0x05;  // Columns 4-7: grass/road border
-        PPU_DATA = 0x00;  // Columns 8-11: road
-        PPU_DATA = 0x00;  // Columns 12-15: road
-        PPU_DATA = 0x00;  // Columns 16-19: road
-        PPU_DATA = 0x00;  // Columns 20-23: road
-        PPU_DATA = 0x50;  // Columns 24-27: road/grass border
-        PPU_DATA = 0x55;  // Columns 28-31: grass
-    }
+    // Nametable and attribute table ($2000-$23FF)
+    ppu_addr(0x2000);
+    vram_unrle(nt);
 
     ppu_on();
 }
 
-// Clear center line for title screen (replace dashed line with plain road)
-static void clear_center_line(void) {
-    unsigned char row;
-
-    wait_vblank();
-    ppu_off();
+// Queue the next rows of clear_center_line() while this vblank has room:
+// the two center line tiles on dashed rows, the whole road on rows that
+// have (or are about to lose) wall tiles
+static void road_clear_step(void) {
+    unsigned char row, i, walls;
+    unsigned char *bits;
 
-    // Overwrite center line tiles (columns 15-16) with plain road
-    for (row = 0; row < 30; ++row) {
-        ppu_addr(0x2000 + (unsigned int)row * 32 + 15);
-        PPU_DATA = TILE_ROAD;
-        PPU_DATA = TILE_ROAD;
+    for (row = road_clear_row; row < 30; ++row) {
+        bits = wall_map + (row << 2);
+        walls = bits[0] | bits[1] | bits[2] | bits[3];
+        for (i = 0; i < wall_queue_len; ++i) {
+            if (wall_queue[i] == row) walls = 1;
+        }
+        if (walls) {
+            if (!vram_fill(0x2000 + (unsigned int)row * 32 + WALL_COL_FIRST, WALL_COLS, TILE_ROAD)) break;
+        } else if (!(row & 1)) {
+            if (!vram_fill(0x2000 + (unsigned int)row * 32 + 15, 2, TILE_ROAD)) break;
+        }
     }
+    road_clear_row = row;
+}
 
-    ppu_on();
+// Clear center line for title screen (replace dashed line with plain road)
+// Rows go through the VRAM queue as fills over the next few frames
+// (road_clear_step); with rendering off they are all written at once
+static void clear_center_line(void) {
+    road_clear_row = 0;
+    road_clear_step();
 }
 
 // Prepare next enemy spawn (show warning marker)
@@ -1258,12 +1759,13 @@ static void spawn_enemy(void) {
     if (enemy_next_rank < 1) return;
 
     enemy_x[slot] = enemy_next_x;
-    enemy_y[slot] = 8;  // Start just below top of screen
+    enemy_y[slot] = ENEMY_START_Y;  // Start just below the HUD strip
     enemy_on[slot] = 1;
     enemy_passed[slot] = 0;
     enemy_rank[slot] = enemy_next_rank;  // Assign unique rank
     enemy_hp[slot] = 2;  // 2 HP - can take 2 grazes to destroy
     enemy_destroyed[slot] = 0;  // Not destroyed yet
+    start_enemy_pattern(slot);
     enemy_next_rank--;  // Next enemy gets lower rank
     enemy_warn_timer = 0;
     // Cycle through slots (can't use bitwise AND since MAX_ENEMIES is not power of 2)
@@ -1277,148 +1779,412 @@ static unsigned char abs_diff(unsigned char a, unsigned char b) {
     return b - a;
 }
 
-// Spawn a single bullet (circular buffer - overwrites oldest)
-static void spawn_bullet(unsigned char x, unsigned char y, signed char dx, signed char dy) {
-    // Use circular buffer - always use next slot, overwriting old bullets
-    bullet_x[bullet_next] = x;
-    bullet_y[bullet_next] = y;
-    bullet_dx[bullet_next] = dx;
-
-    // Increase bullet speed slightly in later loops
-    // Add +1 speed for every 3 loops
-    if (dy > 0) {
-        dy += (loop_count / 3);  // Moving down
-        if (dy > 5) dy = 5;  // Cap at 5
-    } else if (dy < 0) {
-        dy -= (loop_count / 3);  // Moving up (more negative)
-        if (dy < -5) dy = -5;
+// Clear all bullets (every slot back to the free part of the list)
+static void clear_bullets(void) {
+    unsigned char i;
+    for (i = 0; i < MAX_BULLETS; ++i) {
+        bullet_slot[i] = i;
+    }
+    bullet_count = 0;
+    bullet_next = 0;
+    bullet_step = 0;
+    bullet_hit = 0;
+    bullet_graze = 0;
+}
+
+// Kill the bullet at live list position k - O(1)
+// The last live entry moves into k, so callers iterating the list
+// must re-check position k instead of advancing
+static void kill_bullet(unsigned char k) {
+    unsigned char slot = bullet_slot[k];
+    --bullet_count;
+    bullet_slot[k] = bullet_slot[bullet_count];
+    bullet_slot[bullet_count] = slot;
+}
+
+// Spawn a single bullet - O(1)
+// Uses a free slot while there is one; when the pool is full it overwrites
+// live bullets in rotation (like the old circular buffer)
+// dir: 0-63 (0 = right, 16 = down), speed: class 0-3 (2/3/4/5 px/frame)
+static void spawn_bullet(unsigned char x, unsigned char y, unsigned char dir, unsigned char speed) {
+    unsigned char slot;
+
+    if (bullet_count < MAX_BULLETS) {
+        slot = bullet_slot[bullet_count];
+        ++bullet_count;
+    } else {
+        slot = bullet_slot[bullet_next];
+        ++bullet_next;
+        if (bullet_next >= MAX_BULLETS) {
+            bullet_next = 0;
+        }
     }
 
-    bullet_dy[bullet_next] = dy;
-    bullet_on[bullet_next] = 1;
-    bullet_grazed[bullet_next] = 0;  // Reset graze flag for new bullet
-    ++bullet_next;
-    if (bullet_next >= MAX_BULLETS) {
-        bullet_next = 0;
+    bullet_x[slot] = x;
+    bullet_y[slot] = y;
+    bullet_xf[slot] = 0x80;  // Start at the pixel center
+    bullet_yf[slot] = 0x80;
+
+    // Increase bullet speed slightly in later loops (cap at 5 pixels/frame)
+    speed += diff_speed;
+    if (speed > 3) speed = 3;
+
+    bullet_vel[slot] = (speed << 6) | (dir & 63);
+    bullet_flags[slot] = 0;  // Not grazed yet
+}
+
+// ============================================
+// WALL LAYER (road tile hazards)
+// ============================================
+// Walls are placed in the hidden row just above the screen top, scroll down
+// with the road and are erased when that row comes round again (it has
+// just left the bottom). Changed rows are queued; draw_game builds one row
+// into the VRAM queue and the NMI writes it with the frame.
+
+static const unsigned char bit_mask[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+
+// No walls, nothing queued (new race / new loop; draw_road redraws the road)
+static void clear_walls(void) {
+    unsigned char i;
+    for (i = 0; i < 30 * 4; ++i) {
+        wall_map[i] = 0;
     }
+    wall_row = 0xFF;
+    wall_pend_n = 0;
+    wall_queue_len = 0;
 }
 
-// Current pattern phase for complex patterns
-static unsigned char pattern_phase;
-static unsigned char pattern_type;
+// Queue nametable row for a flush (once; dropped if the queue is full)
+static void wall_push(unsigned char row) {
+    unsigned char i;
+    for (i = 0; i < wall_queue_len; ++i) {
+        if (wall_queue[i] == row) return;
+    }
+    if (wall_queue_len < WALL_QUEUE) {
+        wall_queue[wall_queue_len++] = row;
+    }
+}
 
-// Calculate aimed bullet velocity - X component
-static signed char calc_aim_dx(unsigned char bx) {
-    unsigned char px = player_x + 8;
-    if (px > bx + 24) return 2;
-    if (px > bx + 8) return 1;
-    if (px + 24 < bx) return -2;
-    if (px + 8 < bx) return -1;
-    return 0;
+// Wall of n tiles centered on screen X, placed in the next hidden row
+// (one pending wall; a newer one replaces it)
+static void wall_spawn(unsigned char x, unsigned char n) {
+    unsigned char col = x >> 3;
+    unsigned char half = n >> 1;
+    if (col < WALL_COL_FIRST + half) {
+        col = WALL_COL_FIRST;
+    } else {
+        col -= half;
+    }
+    if (col + n > WALL_COL_FIRST + WALL_COLS) col = WALL_COL_FIRST + WALL_COLS - n;
+    wall_pend_col = col;
+    wall_pend_n = n;
+}
+
+// Call after scroll_y moves. The road wraps every 30 rows (240 lines), so
+// the only rows off screen are the ones under the HUD strip. The row just
+// above the road's top line is hidden for 17 lines of scroll
+static void wall_update(void) {
+    unsigned char h, col, n;
+    unsigned char *bits;
+
+    h = (scroll_y + HUD_LINES - 8) >> 3;  // Lines 8h..8h+7 are under the strip
+    if (h >= 30) h -= 30;
+    if (h == wall_row) return;
+    wall_row = h;
+
+    bits = wall_map + (h << 2);
+    if (!(bits[0] | bits[1] | bits[2] | bits[3] | wall_pend_n)) return;
+    bits[0] = bits[1] = bits[2] = bits[3] = 0;  // Scrolled away: back to road
+    col = wall_pend_col;
+    for (n = wall_pend_n; n; --n) {
+        bits[col >> 3] |= bit_mask[col & 7];
+        ++col;
+    }
+    wall_pend_n = 0;
+    wall_push(h);
+}
+
+// Collision by tile lookup under the hitbox center; a hit removes that tile
+static unsigned char wall_hit(void) {
+    unsigned char row, col, m;
+    unsigned char *cell;
+    unsigned int y;
+
+    y = player_y + 8 + scroll_y;  // Nametable line, mod 240
+    if (y >= 240) y -= 240;
+    row = (unsigned char)(y >> 3);
+    col = (player_x + 8) >> 3;
+    cell = wall_map + (row << 2) + (col >> 3);
+    m = bit_mask[col & 7];
+    if (!(*cell & m)) return 0;
+    *cell &= ~m;
+    wall_push(row);
+    return 1;
+}
+
+// Build the oldest queued row into the VRAM queue (one row per frame)
+static void wall_build(void) {
+    unsigned char i, row, col;
+    unsigned char *bits, *tiles;
+
+    if (!wall_queue_len) return;
+    row = wall_queue[0];
+    tiles = vram_run(0x2000 + (unsigned int)row * 32 + WALL_COL_FIRST, WALL_COLS);
+    if (!tiles) return;
+    --wall_queue_len;
+    for (i = 0; i < wall_queue_len; ++i) {
+        wall_queue[i] = wall_queue[i + 1];
+    }
+
+    bits = wall_map + (row << 2);
+    col = WALL_COL_FIRST;
+    for (i = 0; i < WALL_COLS; ++i) {
+        tiles[i] = (bits[col >> 3] & bit_mask[col & 7]) ? TILE_WALL : road_tile(row, col);
+        ++col;
+    }
+}
+
+// Direction (0-63) from (bx, by) towards the player center - 8-bit atan
+// Distances are halved until both fit in 4 bits, then atan_tab gives the
+// angle in the first quadrant, mirrored into the right quadrant by sign
+static unsigned char aim_dir(unsigned char bx, unsigned char by) {
+    unsigned char px, py, ax, ay, dir;
+
+    px = player_x + 8;
+    py = player_y + 8;
+    ax = (px >= bx) ? (px - bx) : (bx - px);
+    ay = (py >= by) ? (py - by) : (by - py);
+    while ((ax | ay) & 0xF0) {
+        ax >>= 1;
+        ay >>= 1;
+    }
+    dir = atan_tab[(ay << 4) | ax];
+    if (px < bx) dir = 32 - dir;  // Left half
+    if (py < by) dir = 64 - dir;  // Upper half
+    return dir & 63;
 }
 
-// Calculate aimed bullet velocity - Y component
-static signed char calc_aim_dy(unsigned char by) {
-    unsigned char py = player_y + 8;
-    if (py > by + 24) return 2;
-    if (py > by + 8) return 1;
-    if (py + 24 < by) return -2;
-    if (py + 8 < by) return -1;
-    return 0;
+// ============================================
+// DANMAKU PATTERN BYTECODE
+// ============================================
+// Every shooter runs a small program from ROM with its own cursor.
+// A waiting shooter costs one decrement per frame; otherwise opcodes run
+// until the next wait (every program must contain a wait).
+//   PAT_END              restart the program
+//   PAT_WAIT n           wait n frames (n >= 1)
+//   PAT_WAIT_FIRE        wait the normal enemy fire interval
+//   PAT_AIM              direction = towards the player
+//   PAT_TURN d           direction += d (signed, 1/64 turns)
+//   PAT_FIRE n s v       n-way fan centered on direction, s apart, speed class v
+//   PAT_ROW n g v        n parallel shots g pixels apart, speed class v
+//   PAT_SETX x           emitter X offset = x
+//   PAT_MOVE d           emitter X offset += d (signed)
+//   PAT_REPEAT n         run the block up to PAT_LOOP n times
+//   PAT_LOOP             end of a PAT_REPEAT block (no nesting)
+//   PAT_WALL n           n-tile wall on the road, centered on the emitter
+#define PAT_END        0
+#define PAT_WAIT       1
+#define PAT_WAIT_FIRE  2
+#define PAT_AIM        3
+#define PAT_TURN       4
+#define PAT_FIRE       5
+#define PAT_ROW        6
+#define PAT_SETX       7
+#define PAT_MOVE       8
+#define PAT_REPEAT     9
+#define PAT_LOOP       10
+#define PAT_WALL       11
+
+#define PAT_NEG(n) ((unsigned char)-(n))
+
+// Speed classes (spawn_bullet adds the loop bonus)
+#define SPD_2PX  0
+#define SPD_3PX  1
+
+// Normal enemy: aimed shot at the loop's fire rate
+static const unsigned char pat_normal[] = {
+    PAT_AIM, PAT_FIRE, 1, 0, SPD_3PX,
+    PAT_WAIT_FIRE,
+    PAT_END
+};
+
+// Rank 1 (Final Boss): 5-way fan, spiral sweep across the aim, 3-shot row
+static const unsigned char pat_boss1[] = {
+    PAT_AIM, PAT_FIRE, 5, 4, SPD_3PX,
+    PAT_TURN, PAT_NEG(8),
+    PAT_REPEAT, 4,
+        PAT_FIRE, 1, 0, SPD_3PX, PAT_TURN, 4, PAT_WAIT, 4,
+    PAT_LOOP,
+    PAT_AIM, PAT_ROW, 3, 8, SPD_3PX,
+    PAT_WAIT, 16,
+    PAT_END
+};
+
+// Rank 2: 3-way fans with a narrower spiral sweep
+static const unsigned char pat_boss2[] = {
+    PAT_AIM, PAT_FIRE, 3, 4, SPD_3PX,
+    PAT_TURN, PAT_NEG(6),
+    PAT_REPEAT, 4,
+        PAT_FIRE, 1, 0, SPD_3PX, PAT_TURN, 3, PAT_WAIT, 4,
+    PAT_LOOP,
+    PAT_AIM, PAT_FIRE, 3, 4, SPD_3PX,
+    PAT_WAIT, 16,
+    PAT_END
+};
+
+// Rank 3: aimed shots and an occasional 2-way, walls in its wake
+static const unsigned char pat_boss3[] = {
+    PAT_AIM, PAT_FIRE, 1, 0, SPD_3PX,
+    PAT_WAIT, 16,
+    PAT_AIM, PAT_FIRE, 1, 0, SPD_3PX, PAT_FIRE, 2, 8, SPD_3PX,
+    PAT_WALL, 4,
+    PAT_WAIT, 16,
+    PAT_END
+};
+
+// 1st place with no enemies left: aimed wave from behind
+// Two emitters sweep 64px across the road in opposite directions
+static const unsigned char pat_rear_right[] = {
+    PAT_SETX, 0,
+    PAT_REPEAT, 16,
+        PAT_AIM, PAT_FIRE, 1, 0, SPD_2PX, PAT_MOVE, 4, PAT_WAIT, 16,
+    PAT_LOOP,
+    PAT_END
+};
+
+static const unsigned char pat_rear_left[] = {
+    PAT_SETX, 0,
+    PAT_REPEAT, 16,
+        PAT_AIM, PAT_FIRE, 1, 0, SPD_2PX, PAT_MOVE, PAT_NEG(4), PAT_WAIT, 16,
+    PAT_LOOP,
+    PAT_END
+};
+
+// ...plus an aimed pair from the middle of the road
+static const unsigned char pat_rear_center[] = {
+    PAT_SETX, 0, PAT_AIM, PAT_FIRE, 1, 0, SPD_3PX,
+    PAT_SETX, 32, PAT_AIM, PAT_FIRE, 1, 0, SPD_3PX,
+    PAT_WAIT, 32,
+    PAT_END
+};
+
+static const unsigned char * const pat_boss[3] = { pat_boss1, pat_boss2, pat_boss3 };
+
+// Shooters: one per enemy slot, then the three rear wave emitters
+#define SHOOTER_REAR  MAX_ENEMIES
+#define MAX_SHOOTERS  (MAX_ENEMIES + 3)
+
+static const unsigned char *pat_pc[MAX_SHOOTERS];     // Next opcode
+static const unsigned char *pat_start[MAX_SHOOTERS];  // Program start (PAT_END)
+static const unsigned char *pat_loop[MAX_SHOOTERS];   // PAT_REPEAT block start
+static unsigned char pat_wait[MAX_SHOOTERS];          // Frames left to wait
+static unsigned char pat_count[MAX_SHOOTERS];         // PAT_REPEAT counter
+static unsigned char pat_dir[MAX_SHOOTERS];           // Current direction (0-63)
+static unsigned char pat_ox[MAX_SHOOTERS];            // Emitter X offset
+
+// Point shooter k at a program, first opcode runs after 'wait' frames
+static void start_pattern(unsigned char k, const unsigned char *prog, unsigned char wait) {
+    pat_pc[k] = prog;
+    pat_start[k] = prog;
+    pat_wait[k] = wait;
+    pat_ox[k] = 0;
 }
 
-// Spawn boss danmaku - aimed patterns towards player
-// Rank 1: Intense patterns, Rank 2: Moderate, Rank 3: Mild
-static void spawn_boss_danmaku(unsigned char i, unsigned char cx, unsigned char cy) {
-    unsigned char pattern, angle, rank;
-    signed char dx, dy, aim_dx, aim_dy;
-
-    rank = enemy_rank[i];
-    // Boss pattern based on rank and timer
-    pattern = (bullet_timer + rank * 64) & 0xFF;
-
-    // Calculate base aim direction
-    aim_dx = calc_aim_dx(cx);
-    aim_dy = calc_aim_dy(cy);
-    // Ensure some movement if directly aligned
-    if (aim_dy == 0) aim_dy = (cy < player_y) ? 1 : -1;
-
-    // Rank 1 (Final Boss): Full intensity - all patterns
-    // Rank 2: Moderate intensity - fewer patterns, slower
-    // Rank 3: Mild intensity - simple patterns only
-
-    if (rank == 1) {
-        // Final Boss: Maximum intensity
-        // Pattern 1: Aimed spiral (every 12 frames)
-        if ((pattern & 0x0B) == 0) {
-            angle = pattern >> 3;
-            switch (angle & 0x03) {
-                case 0: dx = aim_dx;     dy = aim_dy + 1; break;
-                case 1: dx = aim_dx + 1; dy = aim_dy;     break;
-                case 2: dx = aim_dx;     dy = aim_dy - 1; break;
-                default: dx = aim_dx - 1; dy = aim_dy;    break;
-            }
-            spawn_bullet(cx, cy, dx, dy);
-        }
-        // Pattern 2: 5-way spread (every 32 frames)
-        if ((pattern & 0x1F) == 0) {
-            spawn_bullet(cx, cy, aim_dx, aim_dy);
-            spawn_bullet(cx, cy, aim_dx - 1, aim_dy);
-            spawn_bullet(cx, cy, aim_dx + 1, aim_dy);
-            spawn_bullet(cx, cy, aim_dx - 2, aim_dy);
-            spawn_bullet(cx, cy, aim_dx + 2, aim_dy);
-        }
-        // Pattern 3: Aimed burst (every 48 frames)
-        if ((pattern & 0x2F) == 0) {
-            spawn_bullet(cx, cy, aim_dx, aim_dy);
-            spawn_bullet(cx - 8, cy, aim_dx, aim_dy);
-            spawn_bullet(cx + 8, cy, aim_dx, aim_dy);
-        }
-    } else if (rank == 2) {
-        // Rank 2: Moderate intensity
-        // Pattern 1: Aimed spiral (every 20 frames - slower)
-        if ((pattern & 0x13) == 0) {
-            angle = pattern >> 3;
-            switch (angle & 0x03) {
-                case 0: dx = aim_dx;     dy = aim_dy + 1; break;
-                case 1: dx = aim_dx + 1; dy = aim_dy;     break;
-                case 2: dx = aim_dx;     dy = aim_dy - 1; break;
-                default: dx = aim_dx - 1; dy = aim_dy;    break;
-            }
-            spawn_bullet(cx, cy, dx, dy);
-        }
-        // Pattern 2: 3-way spread (every 40 frames)
-        if ((pattern & 0x27) == 0) {
-            spawn_bullet(cx, cy, aim_dx, aim_dy);
-            spawn_bullet(cx, cy, aim_dx - 1, aim_dy);
-            spawn_bullet(cx, cy, aim_dx + 1, aim_dy);
-        }
+// Pick an enemy slot's program by rank; slots fire staggered
+static void start_enemy_pattern(unsigned char slot) {
+    if (enemy_rank[slot] <= 3) {
+        start_pattern(slot, pat_boss[enemy_rank[slot] - 1], slot << 2);
     } else {
-        // Rank 3: Mild intensity
-        // Simple aimed shots (every 24 frames)
-        if ((pattern & 0x17) == 0) {
-            spawn_bullet(cx, cy, aim_dx, aim_dy);
-        }
-        // Occasional 2-way (every 48 frames)
-        if ((pattern & 0x2F) == 0) {
-            spawn_bullet(cx, cy, aim_dx - 1, aim_dy);
-            spawn_bullet(cx, cy, aim_dx + 1, aim_dy);
-        }
+        start_pattern(slot, pat_normal, slot << 2);
     }
 }
 
-// Spawn danmaku pattern from enemies
-static void spawn_danmaku(void) {
-    unsigned char i, cx, cy;
-    signed char dx, dy;
-    unsigned char mask;
+// Restart the rear wave emitters (new race / new loop)
+static void reset_patterns(void) {
+    start_pattern(SHOOTER_REAR, pat_rear_right, 0);
+    start_pattern(SHOOTER_REAR + 1, pat_rear_left, 8);
+    start_pattern(SHOOTER_REAR + 2, pat_rear_center, 0);
+}
 
-    ++bullet_timer;
+// Step shooter k's program by one frame, emitting from (x + X offset, y)
+static void run_pattern(unsigned char k, unsigned char x, unsigned char y) {
+    const unsigned char *pc;
+    unsigned char n, step, speed, dir, sx;
 
-    // Change pattern every 256 frames
-    if (bullet_timer == 0) {
-        pattern_type = (pattern_type + 1) & 0x07;
+    if (pat_wait[k]) {
+        --pat_wait[k];
+        return;
+    }
+
+    pc = pat_pc[k];
+    x += pat_ox[k];
+    for (;;) {
+        switch (*pc++) {
+            case PAT_WAIT:
+                pat_wait[k] = *pc++ - 1;  // This frame counts as the first
+                pat_pc[k] = pc;
+                return;
+            case PAT_WAIT_FIRE:
+                // Loop's fire interval, slower when shooting up
+                pat_wait[k] = ((y > player_y + 8) ? diff_fire_up : diff_fire_down) - 1;
+                pat_pc[k] = pc;
+                return;
+            case PAT_AIM:
+                pat_dir[k] = aim_dir(x, y);
+                break;
+            case PAT_TURN:
+                pat_dir[k] += *pc++;
+                break;
+            case PAT_FIRE:
+                n = pc[0];
+                step = pc[1];
+                speed = pc[2];
+                pc += 3;
+                dir = pat_dir[k] - (((n - 1) * step) >> 1);
+                for (; n; --n) {
+                    spawn_bullet(x, y, dir, speed);
+                    dir += step;
+                }
+                break;
+            case PAT_ROW:
+                n = pc[0];
+                step = pc[1];
+                speed = pc[2];
+                pc += 3;
+                sx = x - (((n - 1) * step) >> 1);
+                for (; n; --n) {
+                    spawn_bullet(sx, y, pat_dir[k], speed);
+                    sx += step;
+                }
+                break;
+            case PAT_SETX:
+                x += *pc - pat_ox[k];
+                pat_ox[k] = *pc++;
+                break;
+            case PAT_MOVE:
+                x += *pc;
+                pat_ox[k] += *pc++;
+                break;
+            case PAT_REPEAT:
+                pat_count[k] = *pc++;
+                pat_loop[k] = pc;
+                break;
+            case PAT_LOOP:
+                if (--pat_count[k]) pc = pat_loop[k];
+                break;
+            case PAT_WALL:
+                wall_spawn(x, *pc++);
+                break;
+            default:  // PAT_END
+                pc = pat_start[k];
+                break;
+        }
     }
+}
+
+// Spawn danmaku: step the pattern program of every active shooter
+static void spawn_danmaku(void) {
+    unsigned char i;
 
     // Burst pattern: 3 bursts then 2 pauses (cycle of ~80 frames)
     // Use counter reset instead of modulo (% 80) for performance
@@ -1431,26 +2197,11 @@ static void spawn_danmaku(void) {
         for (i = 0; i < MAX_ENEMIES; ++i) {
             if (enemy_on[i]) has_retreating = 1;
         }
-        // If no enemies left, spawn danmaku from behind
+        // If no enemies left, the rear emitters fire
         if (!has_retreating && burst_phase < 56) {
-            // Wave pattern from bottom - sweeping left to right
-            if ((bullet_timer & 0x17) == 0) {
-                cx = 80 + ((bullet_timer >> 2) & 0x3F);
-                dx = calc_aim_dx(cx);
-                spawn_bullet(cx, 236, dx, -2);
-            }
-            if ((bullet_timer & 0x17) == 12) {
-                cx = 176 - ((bullet_timer >> 2) & 0x3F);
-                dx = calc_aim_dx(cx);
-                spawn_bullet(cx, 236, dx, -2);
-            }
-            // Center aimed shot
-            if ((bullet_timer & 0x2F) == 0) {
-                cx = ROAD_LEFT + 64;
-                dx = calc_aim_dx(cx);
-                spawn_bullet(cx, 232, dx, -3);
-                spawn_bullet(cx + 32, 232, calc_aim_dx(cx + 32), -3);
-            }
+            run_pattern(SHOOTER_REAR, 80, 236);
+            run_pattern(SHOOTER_REAR + 1, 176, 236);
+            run_pattern(SHOOTER_REAR + 2, ROAD_LEFT + 64, 232);
             return;
         }
         // Fall through to let retreating enemies shoot
@@ -1460,112 +2211,165 @@ static void spawn_danmaku(void) {
     for (i = 0; i < MAX_ENEMIES; ++i) {
         if (!enemy_on[i]) continue;
         if (enemy_destroyed[i]) continue;  // Destroyed enemies don't shoot
-        if (enemy_y[i] < 24 && enemy_y[i] < player_y) continue;
-
-        cx = enemy_x[i] + 8;
-        cy = enemy_y[i] + 8;
-
-        // Boss enemies (rank 1-3): special danmaku patterns
-        // Continue shooting even when retreating (passed)
-        if (enemy_rank[i] <= 3) {
-            // Bosses fire continuously with beautiful patterns (no pause phase)
-            spawn_boss_danmaku(i, cx, cy);
-            continue;
-        }
-
-        // Normal enemies: pause phase
-        if (burst_phase >= 48) continue;
-
-        dx = calc_aim_dx(cx);
-        dy = (enemy_y[i] > player_y) ? -3 : 3;
-
-        mask = 0x17;
-        if (loop_count >= 2) mask = 0x0F;
-        if (loop_count >= 3) mask = 0x0B;
-        if (dy < 0) mask |= 0x10;  // Slower when shooting up
-
-        // Offset timing per enemy
-        if (((bullet_timer + (i << 3)) & mask) == 0) {
-            spawn_bullet(cx, cy, dx, dy);
+        if (enemy_y[i] < ENEMY_START_Y + 16 && enemy_y[i] < player_y) continue;
+
+        // Bosses (rank 1-3) fire continuously, even when retreating (passed)
+        // Normal enemies: pause phase (program holds its place)
+        if (enemy_rank[i] > 3 && burst_phase >= 48) continue;
+
+        run_pattern(i, enemy_x[i] + 8, enemy_y[i] + 8);
+    }
+}
+
+#ifdef BULLETS_C_REF
+// C reference for bullet_kernel (build with make BULLETS_C_REF=1)
+// Kept in sync with src/bullets.s so the two paths can be diffed
+static unsigned char bullet_kernel_ref(unsigned char id) {
+    unsigned char i, s, v, bx, by, dx, dy;
+    unsigned int f;
+#ifdef SPRITES_8X16
+    unsigned char pend = 0xFF;  // OAM offset of the last unstacked bullet sprite
+#endif
+
+    i = 0;
+    while (i < bullet_count) {
+        s = bullet_slot[i];
+        bx = bullet_x[s];
+        by = bullet_y[s];
+
+        // Move - LOD: far bullets (top/bottom of screen) move every other frame
+        // 8.8 add: sub-pixel byte first, its carry goes into the pixel
+        // Velocity comes from the ROM tables via the bullet's velocity id
+        if (bk_step && !(bk_odd && (by < 40 || by > 200))) {
+            v = bullet_vel[s];
+            f = bullet_xf[s] + vel_dxf[v];
+            bullet_xf[s] = f;
+            bx += vel_dx[v] + (f >> 8);
+            f = bullet_yf[s] + vel_dyf[v];
+            bullet_yf[s] = f;
+            by += vel_dy[v] + (f >> 8);
+            if (bx < 8 || bx > 248 || by < HUD_LINES || by > 240) {  // Off screen or under the HUD
+                kill_bullet(i);  // Last live bullet moved into i - don't advance
+                continue;
+            }
+            bullet_x[s] = bx;
+            bullet_y[s] = by;
         }
-    }
-}
-
-// Update all bullets (with LOD optimization)
-static void update_bullets(void) {
-    unsigned char i;
-    unsigned char nx, ny;
-    unsigned char by;
-
-    for (i = 0; i < MAX_BULLETS; ++i) {
-        if (!bullet_on[i]) continue;
 
-        by = bullet_y[i];
+        // Broadphase: only bullets in the player's 19px vertical band
+        // (|dy| < 10) go further - one unsigned compare rejects the rest.
+        // dx/dy are offsets into the graze box (0-18, center 9); wrap-around
+        // is safe since bullets are never 128+ px from the player center
+        dy = by - bk_ylo;
+        if (bk_collide && dy < 19) {
+            dx = bx - bk_xlo;
+            if (dx < 19) {
+                // Damage zone: |dx| < 4 && |dy| < 4 (very small hitbox - cockpit only)
+                // One hit per frame: stop testing, keep moving/drawing the rest
+                if ((unsigned char)(dx - 6) < 7 && (unsigned char)(dy - 6) < 7) {
+                    bk_hit = 1;
+                    bk_collide = 0;
+                    kill_bullet(i);
+                    continue;
+                }
 
-        // LOD: Update far bullets (top/bottom of screen) every other frame
-        if ((frame_count & 1) && (by < 40 || by > 200)) {
-            continue;
+                // Record graze candidate (apply later only if no damage)
+                // Only count bullets that haven't been grazed yet
+                if (!(bullet_flags[s] & BULLET_GRAZED)) {
+                    bullet_flags[s] |= BULLET_GRAZED;  // One graze per bullet
+                    bk_graze = 1;
+                }
+            }
         }
 
-        // Move bullet
-        nx = bullet_x[i] + bullet_dx[i];
-        ny = by + bullet_dy[i];
-
-        // Check bounds
-        if (nx < 8 || nx > 248 || ny > 240) {
-            bullet_on[i] = 0;
-        } else {
-            bullet_x[i] = nx;
-            bullet_y[i] = ny;
+        // Draw every bullet while they all fit; on overflow fall back to
+        // flicker: even frames draw even live-list positions, odd frames odd
+        if (bk_all || (i & 1) == bk_odd) {
+#ifdef SPRITES_8X16
+            // Stack onto the previous bullet sprite when it is in the same
+            // column (|dx| <= 1) and 0-8 px above/below: one 8x16 sprite
+            if (pend != 0xFF && (unsigned char)(bx - OAM[pend + 3] + 1) < 3) {
+                dy = by - OAM[pend];
+                if (dy > 8) {
+                    dy = OAM[pend] - by;  // New bullet is the upper one
+                    if (dy <= 8) OAM[pend] = by;
+                }
+                if (dy <= 8) {
+                    OAM[pend + 1] = SPR_TILE(dy ? SPR_BULLET_PAIR - 1 + dy : SPR_BULLET);
+                    pend = 0xFF;
+                    ++bk_pairs;
+                    ++i;
+                    continue;
+                }
+            }
+#endif
+            if (id < bk_limit) {
+#ifdef SPRITES_8X16
+                pend = oam_slot(id) << 2;
+#endif
+                id = set_sprite(id, bx, by, SPR_BULLET, 2);
+            } else {
+                ++bk_shed;  // Only a missing slot counts, not parity flicker
+            }
         }
+        ++i;
     }
+    return id;
 }
+#endif
+
+// Fused bullet pass: move, collide and emit OAM for each live bullet in one loop
+// Each bullet's x/y is loaded once per frame instead of once per pass
+// Moves/collides only when update_game() armed the pass (draw-only while paused)
+// Bullets take every sprite left up to spr_limit (SPR_CLASS_BULLETS); bullets
+// due this frame that found no slot count toward spr_shed, the ones parity
+// flicker skips on purpose do not. Returns next free sprite id
+static unsigned char bullet_pass(unsigned char id) {
+    bk_xlo = player_x + 8 - 9;  // Graze box corner from the player center
+    bk_ylo = player_y + 8 - 9;
+    bk_odd = frame_count & 1;
+    bk_limit = spr_limit;
+    bk_all = (bullet_count <= spr_limit - id);  // Room for every bullet?
+    bk_oam = oam_slot(id) << 2;
+    bk_step = bullet_step;
+    bk_collide = bullet_step && bullet_collide;
+    bk_hit = 0;
+    bk_graze = 0;
+    bk_pairs = 0;
+    bk_shed = 0;
+    bullet_step = 0;
+
+#ifdef BULLETS_C_REF
+    id = bullet_kernel_ref(id);
+#else
+    id = bullet_kernel(id);
+#endif
+    spr_shed += bk_shed;
+
+    // Only record the results here: update_game() applies them
+    if (bk_hit) bullet_hit = 1;
+    if (bk_graze) bullet_graze = 1;
 
-// Check bullet collisions with player (optimized single-pass)
-// Returns 1 if damage occurred, 0 otherwise
-static unsigned char check_bullet_collisions(void) {
-    unsigned char i, dx, dy;
-    unsigned char player_cx, player_cy;
-    unsigned char graze_found = 0;
-
-    if (player_inv > 0) return 0;
-
-    // Precompute player center
-    player_cx = player_x + 8;
-    player_cy = player_y + 8;
-
-    // Single pass: check damage and record graze
-    for (i = 0; i < MAX_BULLETS; ++i) {
-        if (!bullet_on[i]) continue;
-
-        // Inline abs_diff to avoid function call overhead
-        dx = (player_cx >= bullet_x[i]) ? (player_cx - bullet_x[i]) : (bullet_x[i] - player_cx);
-        dy = (player_cy >= bullet_y[i]) ? (player_cy - bullet_y[i]) : (bullet_y[i] - player_cy);
-
-        // Damage zone: dx < 4 && dy < 4 (very small hitbox - cockpit only)
-        if (dx < 4 && dy < 4) {
-            player_inv = 60;
-            bullet_on[i] = 0;
-            if (score > 0) --score;
-            score_multiplier = 1;
-            graze_count = 0;
-            sfx_damage();
-            if (player_hp > 0) --player_hp;
-            if (player_hp == 0) do_game_over();
-            return 1;
-        }
-
-        // Record graze candidate (apply later only if no damage)
-        // Only count bullets that haven't been grazed yet
-        if (dx < 10 && dy < 10 && !bullet_grazed[i]) {
-            bullet_grazed[i] = 1;  // Mark as grazed (one graze per bullet)
-            graze_found = 1;
-        }
-    }
+    return id;
+}
 
-    // Apply graze effect if any NEW grazes found (no damage this frame)
-    if (graze_found) {
-        add_score(score_multiplier * (1 << loop_count));
+// Apply the last bullet pass's hit or graze, from update_game() like the
+// other collisions (the pass itself runs while draw_game() builds OAM).
+// The wall layer is one tile lookup, tested here with the same arming
+static void bullet_effects(void) {
+    if (player_inv == 0 && wall_hit()) bullet_hit = 1;
+
+    if (bullet_hit) {
+        player_inv = 60;
+        score_dec();
+        score_multiplier = 1;
+        graze_count = 0;
+        sfx_damage();
+        if (player_hp > 0) --player_hp;
+        if (player_hp == 0) do_game_over();
+    } else if (bullet_graze) {
+        // Apply graze effect if any NEW grazes found (no damage this frame)
+        add_score(score_multiplier, 1, diff_score_shift);
         if (score_multiplier < 65535u) ++score_multiplier;
         ++graze_count;
         if (graze_count >= 20) {  // 20 grazes for +1 HP (balanced recovery)
@@ -1574,8 +2378,6 @@ static unsigned char check_bullet_collisions(void) {
         }
         sfx_graze();
     }
-
-    return 0;
 }
 
 // ============================================
@@ -1584,14 +2386,14 @@ static unsigned char check_bullet_collisions(void) {
 
 // Initialize save data if not valid
 static void init_save(void) {
-    unsigned char i;
+    unsigned char i, j;
     unsigned char sram_ok = 1;
 
     // SRAM functionality test
-    // Use $6100 (not $6000) to avoid corrupting save_magic which is at $6000
+    // Uses its own byte in the save block - never save_magic or scratch WRAM
     // Note: Web emulators (jsnes) may not persist SRAM - use FCEUX/Mesen for testing
-    *((volatile unsigned char*)0x6100) = 0xAA;
-    if (*((volatile unsigned char*)0x6100) != 0xAA) {
+    save_probe = 0xAA;
+    if (save_probe != 0xAA) {
         sram_ok = 0;  // SRAM not working
     }
 
@@ -1600,8 +2402,7 @@ static void init_save(void) {
         // First run, corrupted save, or SRAM not working - initialize
         save_magic = SAVE_MAGIC;
         for (i = 0; i < NUM_HIGH_SCORES; ++i) {
-            high_scores[i] = 0;
-            high_scores_high[i] = 0;
+            for (j = 0; j < SCORE_BYTES; ++j) high_scores[i][j] = 0;
             high_names[i][0] = 0;  // A
             high_names[i][1] = 0;  // A
             high_names[i][2] = 0;  // A
@@ -1619,34 +2420,35 @@ static void init_save(void) {
     validate_high_scores();
 }
 
-// Compare two 32-bit scores: returns 1 if (a_high:a_low) > (b_high:b_low)
-static unsigned char score_greater(
-    unsigned int a_high, unsigned int a_low,
-    unsigned int b_high, unsigned int b_low) {
-    if (a_high > b_high) return 1;
-    if (a_high < b_high) return 0;
-    return a_low > b_low;
+// Compare two BCD scores: returns 1 if a > b
+// Packed BCD orders like binary byte by byte, most significant byte first
+static unsigned char score_greater(const volatile unsigned char *a,
+                                   const volatile unsigned char *b) {
+    unsigned char i = SCORE_BYTES;
+    while (i) {
+        --i;
+        if (a[i] != b[i]) return a[i] > b[i];
+    }
+    return 0;
 }
 
 // Validate and fix high score order (in case of SRAM corruption)
 static void validate_high_scores(void) {
-    unsigned char i, j;
-    unsigned int temp_low, temp_high;
+    unsigned char i, j, k;
+    unsigned char temp;
     unsigned char temp_name[3];
 
     // Simple bubble sort to ensure descending order
     for (i = 0; i < NUM_HIGH_SCORES - 1; ++i) {
         for (j = i + 1; j < NUM_HIGH_SCORES; ++j) {
             // If score[j] > score[i], swap them
-            if (score_greater(high_scores_high[j], high_scores[j],
-                              high_scores_high[i], high_scores[i])) {
+            if (score_greater(high_scores[j], high_scores[i])) {
                 // Swap scores
-                temp_high = high_scores_high[i];
-                temp_low = high_scores[i];
-                high_scores_high[i] = high_scores_high[j];
-                high_scores[i] = high_scores[j];
-                high_scores_high[j] = temp_high;
-                high_scores[j] = temp_low;
+                for (k = 0; k < SCORE_BYTES; ++k) {
+                    temp = high_scores[i][k];
+                    high_scores[i][k] = high_scores[j][k];
+                    high_scores[j][k] = temp;
+                }
                 // Swap names
                 temp_name[0] = high_names[i][0];
                 temp_name[1] = high_names[i][1];
@@ -1663,36 +2465,32 @@ static void validate_high_scores(void) {
 }
 
 // Check if score qualifies for high score, return rank (0-2) or 255 if not
-static unsigned char check_high_score(unsigned int new_score_high, unsigned int new_score_low) {
+static unsigned char check_high_score(void) {
     unsigned char i;
     for (i = 0; i < NUM_HIGH_SCORES; ++i) {
-        if (score_greater(new_score_high, new_score_low,
-                          high_scores_high[i], high_scores[i])) {
+        if (score_greater(score, high_scores[i])) {
             return i;
         }
     }
     return 255;  // Not a high score
 }
 
-// Insert a new high score at given rank
-static void insert_high_score(unsigned char rank,
-                               unsigned int new_score_high,
-                               unsigned int new_score_low) {
-    unsigned char i;
+// Insert the current score at given rank
+static void insert_high_score(unsigned char rank) {
+    unsigned char i, j;
     // Shift lower scores down
     for (i = NUM_HIGH_SCORES - 1; i > rank; --i) {
-        high_scores[i] = high_scores[i - 1];
-        high_scores_high[i] = high_scores_high[i - 1];
+        for (j = 0; j < SCORE_BYTES; ++j) high_scores[i][j] = high_scores[i - 1][j];
         high_names[i][0] = high_names[i - 1][0];
         high_names[i][1] = high_names[i - 1][1];
         high_names[i][2] = high_names[i - 1][2];
     }
     // Insert new score
-    high_scores[rank] = new_score_low;
-    high_scores_high[rank] = new_score_high;
+    for (j = 0; j < SCORE_BYTES; ++j) high_scores[rank][j] = score[j];
     high_names[rank][0] = entry_name[0];
     high_names[rank][1] = entry_name[1];
     high_names[rank][2] = entry_name[2];
+    title_board_n = 0;  // Leaderboard sprites rebuild on the next title frame
 }
 
 // Initialize name entry
@@ -1727,7 +2525,7 @@ static void do_finish_lose(void) {
 
 // Finish game over after animation - check for high score
 static void finish_game_over(void) {
-    new_score_rank = check_high_score(score_high, score);
+    new_score_rank = check_high_score();
     if (new_score_rank < NUM_HIGH_SCORES) {
         // Got a high score! Go to name entry
         game_state = STATE_HIGHSCORE;
@@ -1756,17 +2554,19 @@ static void init_game(void) {
     position = 12;  // Start in 12th place (last of 12 cars)
     lap_count = 0;
     loop_count = title_select_loop;  // Start from selected loop
-    score = 0;
-    score_high = 0;
+    set_difficulty();
+    for (i = 0; i < SCORE_BYTES; ++i) score[i] = 0;
     distance = 0;
     scroll_y = 0;
     score_multiplier = 1;  // Start with 1x multiplier
+    hud_dirty = HUD_ALL;   // HUD strip is rewritten on the first frames
     graze_count = 0;
     car_graze_cooldown = 0;
     boost_remaining = 2;   // 2 boosts per loop
     boost_active = 0;
     boss_music_active = 0; // No boss music at start
     explode_timer = 0;
+    reset_lag_stats();
 
     // Set music intensity based on starting loop
     // Loop 1 LAP1: calm(0), Loop 2+ LAP1: moderate(1)
@@ -1777,20 +2577,17 @@ static void init_game(void) {
     }
 
     // Clear all bullets
-    for (i = 0; i < MAX_BULLETS; ++i) {
-        bullet_on[i] = 0;
-        bullet_grazed[i] = 0;
-    }
-    bullet_timer = 0;
-    bullet_next = 0;
-    pattern_phase = 0;
-    pattern_type = 0;
+    clear_bullets();
+    clear_walls();
+    reset_patterns();
 
     // Setup PPU like main() does - this order works
     ppu_off();
     load_palettes();
     update_loop_palette();  // Override road/grass colors based on loop_count
-    draw_road();
+    pal_set_bright(0);      // Redrawn road fades in from black
+    pal_fade(PAL_NORMAL, 3);
+    draw_road(nt_race);
 
     // Spawn first enemy immediately (no warning delay)
     enemy_next_x = ROAD_LEFT + 8 + (rnd() & 0x7F);
@@ -1812,19 +2609,20 @@ static void update_player(void) {
     }
     if (pad_now & BTN_UP) {
         // Normal area: full speed
-        // Slowdown zones near top of screen
-        if (player_y > 60) {
+        // Slowdown zones near top of the road, stopping under the HUD strip
+        if (player_y > HUD_LINES + 44) {
             player_y -= speed;
-        } else if (player_y > 40) {
+        } else if (player_y > HUD_LINES + 24) {
             // Zone 1: half speed
             if ((frame_count & 1) == 0) player_y -= speed;
-        } else if (player_y > 24) {
+        } else if (player_y > HUD_LINES + 8) {
             // Zone 2: quarter speed
             if ((frame_count & 3) == 0) player_y -= speed;
-        } else if (player_y > 16) {
+        } else if (player_y > HUD_LINES) {
             // Zone 3: 1/8 speed
             if ((frame_count & 7) == 0) player_y -= speed;
         }
+        if (player_y < HUD_LINES) player_y = HUD_LINES;
     }
     if (pad_now & BTN_DOWN) {
         if (player_y < SCREEN_HEIGHT - 32) player_y += speed;
@@ -1927,7 +2725,7 @@ static void update_enemy(void) {
             // Mark as passed if not already (they're out of the race)
             if (!enemy_passed[i]) {
                 enemy_passed[i] = 1;
-                add_score(20 * score_multiplier);  // Still award overtake points
+                add_score(score_multiplier, 20, 0);  // Still award overtake points
                 if (position > 1) --position;
             }
         }
@@ -1948,27 +2746,19 @@ static void update_enemy(void) {
         }
 
         // AI: try to block player (only if ahead, not for bosses)
-        // Movement frequency increases with loop: loop0=8frames, loop1=4frames, loop2+=2frames
-        {
-            unsigned char move_mask;
-            switch (loop_count) {
-                case 0:  move_mask = 0x07; break;  // Every 8 frames
-                case 1:  move_mask = 0x03; break;  // Every 4 frames
-                default: move_mask = 0x01; break;  // Every 2 frames
-            }
-            if (!enemy_passed[i] && enemy_rank[i] >= 3 && (frame_count & move_mask) == 0) {
-                if (enemy_x[i] + 8 < player_x && enemy_x[i] < ROAD_RIGHT - 24) {
-                    enemy_x[i] += 1;
-                } else if (enemy_x[i] > player_x + 8 && enemy_x[i] > ROAD_LEFT + 8) {
-                    enemy_x[i] -= 1;
-                }
+        // Movement frequency increases with loop (diff_move_mask)
+        if (!enemy_passed[i] && enemy_rank[i] >= 3 && (frame_count & diff_move_mask) == 0) {
+            if (enemy_x[i] + 8 < player_x && enemy_x[i] < ROAD_RIGHT - 24) {
+                enemy_x[i] += 1;
+            } else if (enemy_x[i] > player_x + 8 && enemy_x[i] > ROAD_LEFT + 8) {
+                enemy_x[i] -= 1;
             }
         }
 
         // Overtaken - award points once
         if (player_y + 16 < enemy_y[i] && !enemy_passed[i]) {
             enemy_passed[i] = 1;
-            add_score(20 * score_multiplier);
+            add_score(score_multiplier, 20, 0);
             if (position > 1) --position;
         }
 
@@ -2076,13 +2866,16 @@ static void update_game(void) {
         music_play(TRACK_RACING);
     }
 
-    // Danmaku system
+    // Danmaku system - bullets move, collide and draw in one pass
+    // (bullet_pass from draw_game). Apply the last pass's results and decide
+    // collision here, before invincibility ticks down, and only if no damage
+    // from enemy collision
+    if (!took_damage) bullet_effects();
+    bullet_hit = 0;
+    bullet_graze = 0;
     spawn_danmaku();
-    update_bullets();
-    // Only check bullet collisions if no damage from enemy collision
-    if (!took_damage) {
-        check_bullet_collisions();
-    }
+    bullet_step = 1;
+    bullet_collide = (!took_damage && player_inv == 0);
 
     // Decrement invincibility AFTER all collision checks
     // This prevents "last frame of inv" vulnerability
@@ -2130,6 +2923,7 @@ static void update_game(void) {
             if (position == 1) {
                 // Victory! Advance to next loop (2周目, 3周目...)
                 ++loop_count;
+                set_difficulty();
 
                 // Save new max loop record if achieved
                 if (loop_count > max_loop) {
@@ -2137,15 +2931,12 @@ static void update_game(void) {
                 }
 
                 // Big score bonus for completing a loop (with loop multiplier)
-                add_score(1000 * (loop_count) * (1 << loop_count));
+                add_score(1000, loop_count, loop_count);
 
                 // Clear bullets for fresh start
-                {
-                    unsigned char b;
-                    for (b = 0; b < MAX_BULLETS; ++b) {
-                        bullet_on[b] = 0;
-                    }
-                }
+                clear_bullets();
+                clear_walls();
+                reset_patterns();
 
                 // Go to loop clear celebration screen
                 sfx_stop();
@@ -2167,57 +2958,213 @@ static void update_game(void) {
     } else {
         scroll_y -= SCROLL_SPEED;  // Normal speed
     }
+    // Keep scroll_y in 0-239: 240-255 would show the attribute rows
+    if (scroll_y >= 240) scroll_y -= 16;
+    wall_update();
+}
+
+// Four HUD digits #### (v < 10000)
+static void hud_digits(unsigned char *p, unsigned int v) {
+    p[0] = TILE_DIGIT + (v / 1000);
+    v %= 1000;
+    p[1] = TILE_DIGIT + (v / 100);
+    v %= 100;
+    p[2] = TILE_DIGIT + (v / 10);
+    p[3] = TILE_DIGIT + (v % 10);
+}
+
+// Scientific form XXE#: mantissa 10-99, exponent digit
+static void hud_sci(unsigned char *p, unsigned char mantissa, unsigned char exp) {
+    p[0] = TILE_DIGIT + (mantissa / 10);
+    p[1] = TILE_DIGIT + (mantissa % 10);
+    p[2] = TILE_LETTER + 4;  // E
+    p[3] = TILE_DIGIT + exp;
+}
+
+// Queue the HUD fields whose value changed since they were last queued
+// Most frames this is a few compares
+static void hud_update(void) {
+    unsigned char exp;
+    unsigned char i, top, bar;
+    unsigned char *p;
+    unsigned int progress;
+
+    if (player_hp != hud_hp) hud_dirty |= HUD_HP;
+    if (loop_count != hud_loop) hud_dirty |= HUD_LOOP;
+    if (score_multiplier != hud_mult) hud_dirty |= HUD_MULT;
+    for (i = 0; i < SCORE_BYTES; ++i) {
+        if (score[i] != hud_score[i]) hud_dirty |= HUD_SCORE;
+    }
+
+    // Progress across all 3 laps, 8 cells per lap
+    progress = (unsigned int)lap_count * LAP_DISTANCE + distance;
+    bar = (unsigned char)((progress * 2u) / 175u);  // * HUD_BAR_CELLS / 2100
+    if (bar >= HUD_BAR_CELLS) bar = HUD_BAR_CELLS - 1;
+    if (bar != hud_bar) hud_dirty |= HUD_BAR;
+
+    if (!hud_dirty) return;
+
+    // HP: 2 digits (display capped at 99)
+    if (hud_dirty & HUD_HP) {
+        p = vram_run(HUD_NT(HUD_ROW_TEXT, HUD_HP_COL), 2);
+        if (p) {
+            unsigned char hp = player_hp;
+            hud_hp = hp;
+            if (hp > 99) hp = 99;
+            p[0] = TILE_DIGIT + (hp / 10);
+            p[1] = TILE_DIGIT + (hp % 10);
+            hud_dirty &= ~HUD_HP;
+        }
+    }
+
+    // Loop: "L#" from the second loop on
+    if (hud_dirty & HUD_LOOP) {
+        p = vram_run(HUD_NT(HUD_ROW_TEXT, HUD_LOOP_COL), 2);
+        if (p) {
+            hud_loop = loop_count;
+            p[0] = p[1] = 0;
+            if (loop_count > 0) {
+                p[0] = TILE_LETTER + 11;  // L
+                p[1] = TILE_DIGIT + loop_count + 1;
+            }
+            hud_dirty &= ~HUD_LOOP;
+        }
+    }
+
+    // Multiplier: ####, >= 10000 as XXE#
+    if (hud_dirty & HUD_MULT) {
+        p = vram_run(HUD_NT(HUD_ROW_TEXT, HUD_MULT_COL), 4);
+        if (p) {
+            unsigned int m = score_multiplier;
+            hud_mult = m;
+            if (m < 10000u) {
+                hud_digits(p, m);
+            } else {
+                exp = 0;
+                while (m >= 100u) {
+                    m /= 10;
+                    exp++;
+                }
+                hud_sci(p, (unsigned char)m, exp);
+            }
+            hud_dirty &= ~HUD_MULT;
+        }
+    }
+
+    // Score (BCD): ####, >= 10000 as XXE# (12E6 = 12,000,000)
+    // Digits are read straight out of the BCD bytes - no division
+    if (hud_dirty & HUD_SCORE) {
+        p = vram_run(HUD_NT(HUD_ROW_TEXT, HUD_SCORE_COL), 4);
+        if (p) {
+            for (i = 0; i < SCORE_BYTES; ++i) hud_score[i] = score[i];
+            top = score_top(score);
+            if (top < 4) {
+                for (i = 0; i < 4; ++i) {
+                    p[i] = TILE_DIGIT + score_digit(score, 3 - i);
+                }
+            } else if (top < 11) {
+                hud_sci(p, score_digit(score, top) * 10 + score_digit(score, top - 1),
+                        top - 1);
+            } else {
+                // 12 digits: #E11, the exponent needs two digits
+                p[0] = TILE_DIGIT + score_digit(score, top);
+                p[1] = TILE_LETTER + 4;  // E
+                p[2] = TILE_DIGIT + 1;
+                p[3] = TILE_DIGIT + 1;
+            }
+            hud_dirty &= ~HUD_SCORE;
+        }
+    }
+
+    // Progress bar: filled up to the car icon, lap marks rewritten in place
+    if (hud_dirty & HUD_BAR) {
+        p = vram_run(HUD_NT(HUD_ROW_BAR, HUD_BAR_COL), HUD_BAR_CELLS + 2);
+        if (p) {
+            hud_bar = bar;
+            for (i = 0; i < HUD_BAR_CELLS; ++i) {
+                if (i == 8 || i == 16) *p++ = TILE_LAP_MARK;
+                if (i < bar) {
+                    *p++ = TILE_BAR_FILL;
+                } else if (i == bar) {
+                    *p++ = TILE_CAR_ICON;
+                } else {
+                    *p++ = TILE_BAR_EMPTY;
+                }
+            }
+            hud_dirty &= ~HUD_BAR;
+        }
+    }
 }
 
 // Draw game sprites
 static void draw_game(void) {
-    unsigned char id = 0;
+    unsigned char id;
     unsigned char i;
 
+    // Rotate the dynamic OAM region (see oam_slot) one step per frame
+    oam_rot_frame += OAM_ROT_STEP;
+    if (oam_rot_frame >= OAM_DYNAMIC) oam_rot_frame -= OAM_DYNAMIC;
+    oam_rot = oam_rot_frame;
+    spr_shed = 0;
+
+    // Pinned sprites (OAM 0-5, always on top): hidden slots are still reserved
+    for (id = 0; id < OAM_PINNED; ++id) {
+        OAM[id * 4] = 0xFF;
+    }
+
+    // Sprite 0: a line behind the lap mark's bottom row on the HUD strip's
+    // last line. Never visible, its hit switches the NMI over to the road
+    spr_class(0, SPR_CLASS_CRITICAL);
+    set_sprite(0, HUD_SPR0_X, HUD_LINES - 2, SPR_HLINE, 0x20);
+    ppu_split = 1;
+
     // Player car (4 sprites) - skip during explosion/finish (drawn separately)
     if (game_state != STATE_EXPLODE && game_state != STATE_FINISH && (player_inv == 0 || (frame_count & 4))) {
-        id = set_car(id, player_x, player_y, SPR_CAR, 0);
+        draw_meta(1, player_x, player_y, ms_car, 0);
     }
 
     // Hitbox indicator (8x8 centered on player center)
     // Hitbox is dx < 4, dy < 4 from center (player_x+8, player_y+8)
     // Draw 8x8 sprite at center - 4 = player_x+4, player_y+4
     if (game_state == STATE_RACING) {
-        id = set_sprite(id, player_x + 4, player_y + 4, SPR_HITBOX, 0);
+        set_sprite(5, player_x + 4, player_y + 4, SPR_HITBOX, 0);
     }
+    id = OAM_PINNED;
 
     // Enemy cars (4 sprites each) - color/design based on rank
     // Also show rank number above each enemy car
+    spr_class(id, SPR_CLASS_CARS);
     for (i = 0; i < MAX_ENEMIES; ++i) {
         if (enemy_on[i] && enemy_y[i] >= HUD_BAND_BOTTOM) {
-            unsigned char tile, pal;
+            const unsigned char *ms;
+            unsigned char pal;
             unsigned char rank = enemy_rank[i];
             unsigned char ex = enemy_x[i];
             unsigned char ey = enemy_y[i];
 
             // Top 3 positions (rank 1-3): Boss design
             if (rank <= 3) {
-                tile = SPR_BOSS;
+                ms = ms_boss;
                 pal = 1;  // Red (boss color)
             }
             // Rank 4-5: Strong enemies (palette 3 = blue/white)
             else if (rank <= 5) {
-                tile = SPR_ENEMY;
+                ms = ms_enemy;
                 pal = 3;
             }
             // Rank 6-8: Medium enemies (palette 2 = green)
             else if (rank <= 8) {
-                tile = SPR_ENEMY;
+                ms = ms_enemy;
                 pal = 2;
             }
             // Rank 9-11: Weak enemies (palette 1 = red)
             else {
-                tile = SPR_ENEMY;
+                ms = ms_enemy;
                 pal = 1;
             }
 
             // Draw rank number FIRST (lower OAM index = appears on top)
-            if (id < 60) {
+            {
                 unsigned char rank_y = ey + 4;  // Center vertically on car
                 if (rank >= 10) {
                     // Two digits: "1X" centered
@@ -2230,327 +3177,321 @@ static void draw_game(void) {
             }
 
             // Draw car AFTER rank number (so number appears on top)
-            id = set_car(id, ex, ey, tile, pal);
+            id = draw_meta(id, ex, ey, ms, pal);
         }
     }
 
+    // === Critical HUD (always visible) ===
+    // HP, loop, multiplier, score and progress are background tiles in the
+    // HUD strip; only changed fields are queued for this vblank
+    spr_class(id, SPR_CLASS_HUD);
+    hud_update();
+
+    // Debug lag readout (SELECT toggles): "L###W##" just below the HUD strip
+    if (debug_hud) {
+        unsigned int lag = lag_frames;
+        unsigned char worst = lag_worst;
+        unsigned char dy = HUD_LINES;
+        if (lag > 999) lag = 999;
+        if (worst > 99) worst = 99;
+        id = set_sprite(id, 24, dy, SPR_LETTER + 11, 2);  // L
+        id = set_sprite(id, 32, dy, SPR_DIGIT + (lag / 100), 3);
+        lag %= 100;
+        id = set_sprite(id, 40, dy, SPR_DIGIT + (lag / 10), 3);
+        id = set_sprite(id, 48, dy, SPR_DIGIT + (lag % 10), 3);
+        id = set_sprite(id, 60, dy, SPR_LETTER + 22, 2);  // W
+        id = set_sprite(id, 68, dy, SPR_DIGIT + (worst / 10), 3);
+        id = set_sprite(id, 76, dy, SPR_DIGIT + (worst % 10), 3);
+    }
+
+    // Warning marker for next enemy (single up arrow at the road's top edge)
+    if (enemy_warn_timer > 0 && (frame_count & 8)) {
+        id = set_sprite(id, enemy_next_x + 4, HUD_LINES, 0x0A, 1);  // red (danger)
+    }
+
+    // === Game objects (may be shed if too many) ===
+
+    // Bullets - danmaku (use remaining sprite slots)
+    // Moved and collided in the same pass when update_game() armed it
+    spr_class(id, SPR_CLASS_BULLETS);
+    id = bullet_pass(id);
+    wall_build();  // Next changed wall row for this vblank
+
     // Explosion effect (1 sprite, blinking) - only during racing
+    spr_class(id, SPR_CLASS_PARTICLES);
     if (game_state == STATE_RACING && explode_timer > 0 && (frame_count & 2)) {
-        id = set_sprite(id, explode_x + 4, explode_y + 4, SPR_EXPLOSION, 1);
+        id = draw_meta(id, explode_x, explode_y, ms_explode0, 1);
     }
+    if (spr_shed > spr_shed_worst) spr_shed_worst = spr_shed;
 
-    // === Critical HUD (always visible) ===
-    // Position is now shown above each enemy car, not in HUD
-    // HUD Layout:
-    // Row 1 (Y=8):   Lap(center), HP(right)
-    // Row 2 (Y=216): Progress indicator (left-center), Multiplier (right)
-    // Row 3 (Y=224): Score (right)
-
-    // HUD - HP (3 sprites) - top right: ❤XX
-    {
-        unsigned char hp = player_hp;
-        if (hp > 99) hp = 99;  // Cap display at 99
-        id = set_sprite(id, 208, HUD_TOP_Y, SPR_HEART, 1);  // Red heart
-        id = set_sprite(id, 216, HUD_TOP_Y, SPR_DIGIT + (hp / 10), 3);
-        id = set_sprite(id, 224, HUD_TOP_Y, SPR_DIGIT + (hp % 10), 3);
-    }
-
-    // HUD - Multiplier "x" + max 4 digits - bottom right row 1
-    // < 10000: x#### (5 sprites), >= 10000: xXXE# scientific (5 sprites)
-    {
-        unsigned int m = score_multiplier;
-        unsigned char mult_x = 200;
-        id = set_sprite(id, mult_x, 216, SPR_LETTER + 23, 3);  // x prefix
-        mult_x += 8;
-
-        if (m < 10000u) {
-            // Normal 4-digit display (white)
-            id = set_sprite(id, mult_x, 216, SPR_DIGIT + (m / 1000), 3);
-            m %= 1000;
-            id = set_sprite(id, mult_x + 8, 216, SPR_DIGIT + (m / 100), 3);
-            m %= 100;
-            id = set_sprite(id, mult_x + 16, 216, SPR_DIGIT + (m / 10), 3);
-            id = set_sprite(id, mult_x + 24, 216, SPR_DIGIT + (m % 10), 3);
-        } else {
-            // Scientific notation: XXE# (red)
-            unsigned char exp = 0;
-            while (m >= 100u) {
-                m /= 10;
-                exp++;
-            }
-            id = set_sprite(id, mult_x, 216, SPR_DIGIT + (m / 10), 2);
-            id = set_sprite(id, mult_x + 8, 216, SPR_DIGIT + (m % 10), 2);
-            id = set_sprite(id, mult_x + 16, 216, SPR_LETTER + 4, 2);  // E
-            id = set_sprite(id, mult_x + 24, 216, SPR_DIGIT + exp, 2);
-        }
-    }
+    hide_rest(id);
+    oam_rot = 0;     // Other screens use plain OAM order
+    spr_limit = 64;  // ... and no sprite budget
+}
 
-    // HUD - Score: bottom right row 2 (max 4 sprites)
-    // Small scores: show 4 digits normally
-    // Large scores: use scientific notation XXE# (e.g., 12E6 = 12,000,000)
-    {
-        unsigned char score_x = 208;
-        unsigned long full_score = ((unsigned long)score_high << 16) + score;
-
-        if (full_score < 10000u) {
-            // Normal 4-digit display (white)
-            id = set_sprite(id, score_x, 224, SPR_DIGIT + (full_score / 1000), 3);
-            full_score %= 1000;
-            id = set_sprite(id, score_x + 8, 224, SPR_DIGIT + (full_score / 100), 3);
-            full_score %= 100;
-            id = set_sprite(id, score_x + 16, 224, SPR_DIGIT + (full_score / 10), 3);
-            id = set_sprite(id, score_x + 24, 224, SPR_DIGIT + (full_score % 10), 3);
-        } else {
-            // Scientific notation: XXE# format (4 sprites)
-            // Find 2-digit mantissa and exponent
-            unsigned char exp = 0;
-            unsigned char mantissa;
-            while (full_score >= 100u) {
-                full_score /= 10;
-                exp++;
-            }
-            mantissa = (unsigned char)full_score;
+// ============================================
+// OAM TEMPLATES (static screen text)
+// ============================================
+// Text that never changes is stored as finished OAM records and copied by
+// draw_template(); set_sprite() only draws what moves or depends on state
+
+#define OAM_SPR(x, y, tile, attr)  (y), SPR_TILE(tile), (attr), (x)
+#define TPL_LEN(t)                 (sizeof(t) / 4)
+
+// Title: version "V5.3" (top right), "EDGE" (blue) over "RACE" (red)
+static const unsigned char tpl_title[] = {
+    OAM_SPR(216,  8, SPR_LETTER + 21, 3),  // V
+    OAM_SPR(224,  8, SPR_DIGIT + 5,   3),  // 5
+    OAM_SPR(232,  8, SPR_DOT,         3),  // .
+    OAM_SPR(240,  8, SPR_DIGIT + 3,   3),  // 3
+    OAM_SPR( 96, 40, SPR_LETTER + 4,  0),  // E
+    OAM_SPR(104, 40, SPR_LETTER + 3,  0),  // D
+    OAM_SPR(112, 40, SPR_LETTER + 6,  0),  // G
+    OAM_SPR(120, 40, SPR_LETTER + 4,  0),  // E
+    OAM_SPR(104, 52, SPR_LETTER + 17, 1),  // R
+    OAM_SPR(112, 52, SPR_LETTER + 0,  1),  // A
+    OAM_SPR(120, 52, SPR_LETTER + 2,  1),  // C
+    OAM_SPR(128, 52, SPR_LETTER + 4,  1)   // E
+};
 
-            // Display in yellow (palette 2): MM E X
-            id = set_sprite(id, score_x, 224, SPR_DIGIT + (mantissa / 10), 2);
-            id = set_sprite(id, score_x + 8, 224, SPR_DIGIT + (mantissa % 10), 2);
-            id = set_sprite(id, score_x + 16, 224, SPR_LETTER + 4, 2);  // E
-            id = set_sprite(id, score_x + 24, 224, SPR_DIGIT + exp, 2);
-        }
-    }
+// Title: "LOOP" label and up/down arrows of the loop selector
+static const unsigned char tpl_title_loop[] = {
+    OAM_SPR(100, 84, SPR_LETTER + 11, 3),  // L
+    OAM_SPR(108, 84, SPR_LETTER + 14, 3),  // O
+    OAM_SPR(116, 84, SPR_LETTER + 14, 3),  // O
+    OAM_SPR(124, 84, SPR_LETTER + 15, 3),  // P
+    OAM_SPR(148, 78, 0x0A, 3),             // Up arrow
+    OAM_SPR(148, 90, 0x0A, 3 | 0x80)       // Down arrow (flipped)
+};
 
-    // Loop counter at center-top (shown when in 2nd loop or higher)
-    if (loop_count > 0) {
-        id = set_sprite(id, 120, HUD_TOP_Y, SPR_LETTER + 11, 3);  // L
-        id = set_sprite(id, 128, HUD_TOP_Y, SPR_DIGIT + loop_count + 1, 2);  // Loop number in yellow
-    }
+// Title: blinking "START" (yellow)
+static const unsigned char tpl_title_start[] = {
+    OAM_SPR(108, 188, SPR_LETTER + 18, 2),  // S
+    OAM_SPR(116, 188, SPR_LETTER + 19, 2),  // T
+    OAM_SPR(124, 188, SPR_LETTER + 0,  2),  // A
+    OAM_SPR(132, 188, SPR_LETTER + 17, 2),  // R
+    OAM_SPR(140, 188, SPR_LETTER + 19, 2)   // T
+};
 
-    // === Game objects (may be culled if too many) ===
+// Title: "2026 FUBA" at bottom-center (no copyright symbol)
+static const unsigned char tpl_title_foot[] = {
+    OAM_SPR( 88, 216, SPR_DIGIT + 2,   3),  // 2
+    OAM_SPR( 96, 216, SPR_DIGIT + 0,   3),  // 0
+    OAM_SPR(104, 216, SPR_DIGIT + 2,   3),  // 2
+    OAM_SPR(112, 216, SPR_DIGIT + 6,   3),  // 6
+    OAM_SPR(128, 216, SPR_LETTER + 5,  3),  // F
+    OAM_SPR(136, 216, SPR_LETTER + 20, 3),  // U
+    OAM_SPR(144, 216, SPR_LETTER + 1,  3),  // B
+    OAM_SPR(152, 216, SPR_LETTER + 0,  3)   // A
+};
 
-    // Warning marker for next enemy (single up arrow at top edge)
-    if (enemy_warn_timer > 0 && (frame_count & 8)) {
-        id = set_sprite(id, enemy_next_x + 4, 8, 0x0A, 1);  // red (danger), top of screen
-    }
+// "GAME" / "OVER" (red)
+static const unsigned char tpl_gameover[] = {
+    OAM_SPR( 88, 100, SPR_LETTER + 6,  1),  // G
+    OAM_SPR( 96, 100, SPR_LETTER + 0,  1),  // A
+    OAM_SPR(104, 100, SPR_LETTER + 12, 1),  // M
+    OAM_SPR(112, 100, SPR_LETTER + 4,  1),  // E
+    OAM_SPR( 96, 116, SPR_LETTER + 14, 1),  // O
+    OAM_SPR(104, 116, SPR_LETTER + 21, 1),  // V
+    OAM_SPR(112, 116, SPR_LETTER + 4,  1),  // E
+    OAM_SPR(120, 116, SPR_LETTER + 17, 1)   // R
+};
 
-    // Bullets - danmaku (use remaining sprite slots)
-    // Flicker rendering: only draw half the bullets per frame to reduce sprite overflow
-    // Even frames draw even-indexed bullets, odd frames draw odd-indexed bullets
-    for (i = 0; i < MAX_BULLETS; ++i) {
-        if (bullet_on[i] && id < 62 && ((i & 1) == (frame_count & 1))) {
-            unsigned char by = bullet_y[i];
-            if (by >= HUD_BAND_BOTTOM) {
-                id = set_sprite(id, bullet_x[i], by, SPR_BULLET, 2);
-            }
-        }
-    }
+// "PLACE" under the finishing position (yellow)
+static const unsigned char tpl_place[] = {
+    OAM_SPR( 88, 116, SPR_LETTER + 15, 2),  // P
+    OAM_SPR( 96, 116, SPR_LETTER + 11, 2),  // L
+    OAM_SPR(104, 116, SPR_LETTER + 0,  2),  // A
+    OAM_SPR(112, 116, SPR_LETTER + 2,  2),  // C
+    OAM_SPR(120, 116, SPR_LETTER + 4,  2)   // E
+};
 
-    // HUD - Vertical progress indicator on left side
-    // Shows total progress across all 3 laps (bottom to top)
-    // Y range: 200 (bottom) to 32 (top) = 168 pixels
-    // Total distance: 3 * 700 = 2100
-    {
-        unsigned int total_progress;
-        unsigned char car_y;
-        unsigned char marker_y1, marker_y2;
+// Name entry: "NEW" / "HIGH" (blue)
+static const unsigned char tpl_hs_head[] = {
+    OAM_SPR(72, 40, SPR_LETTER + 13, 0),  // N
+    OAM_SPR(80, 40, SPR_LETTER + 4,  0),  // E
+    OAM_SPR(88, 40, SPR_LETTER + 22, 0),  // W
+    OAM_SPR(68, 56, SPR_LETTER + 7,  0),  // H
+    OAM_SPR(76, 56, SPR_LETTER + 8,  0),  // I
+    OAM_SPR(84, 56, SPR_LETTER + 6,  0),  // G
+    OAM_SPR(92, 56, SPR_LETTER + 7,  0)   // H
+};
 
-        // Calculate total progress across all laps
-        total_progress = (unsigned int)lap_count * LAP_DISTANCE + distance;
-        if (total_progress > 2100u) total_progress = 2100u;
+// Name entry: "NAME"
+static const unsigned char tpl_hs_name[] = {
+    OAM_SPR( 88, 110, SPR_LETTER + 13, 3),  // N
+    OAM_SPR( 96, 110, SPR_LETTER + 0,  3),  // A
+    OAM_SPR(104, 110, SPR_LETTER + 12, 3),  // M
+    OAM_SPR(112, 110, SPR_LETTER + 4,  3)   // E
+};
 
-        // Map to Y position: 200 - (progress * 168 / 2100)
-        // Simplified: 200 - (progress / 12.5) ≈ 200 - (progress * 2 / 25)
-        car_y = 200 - (unsigned char)((total_progress * 2u) / 25u);
-        if (car_y < 32) car_y = 32;
+// Name entry: up/down arrows and "A OK" hint
+static const unsigned char tpl_hs_hint[] = {
+    OAM_SPR( 80, 136, 0x0A, 0),             // Up arrow
+    OAM_SPR( 80, 148, 0x0A, 0 | 0x80),      // Down arrow
+    OAM_SPR(104, 190, SPR_LETTER + 0,  3),  // A
+    OAM_SPR(116, 190, SPR_LETTER + 14, 3),  // O
+    OAM_SPR(124, 190, SPR_LETTER + 10, 3)   // K
+};
 
-        // Draw car icon at current progress position
-        id = set_sprite(id, 8, car_y, SPR_CAR_ICON, 0);
+// Win: "1ST PLACE"
+static const unsigned char tpl_win_place[] = {
+    OAM_SPR( 88, 90, SPR_DIGIT + 1,   3),  // 1
+    OAM_SPR( 96, 90, SPR_LETTER + 18, 3),  // S
+    OAM_SPR(104, 90, SPR_LETTER + 19, 3),  // T
+    OAM_SPR(116, 90, SPR_LETTER + 15, 3),  // P
+    OAM_SPR(124, 90, SPR_LETTER + 11, 3),  // L
+    OAM_SPR(132, 90, SPR_LETTER + 0,  3),  // A
+    OAM_SPR(140, 90, SPR_LETTER + 2,  3),  // C
+    OAM_SPR(148, 90, SPR_LETTER + 4,  3)   // E
+};
 
-        // Draw GOAL marker at top
-        id = set_sprite(id, 8, 24, SPR_LETTER + 6, 3);  // G (goal)
+// Win: "SCORE" label and "PTS" after the 5-digit value
+static const unsigned char tpl_win_score[] = {
+    OAM_SPR( 88, 150, SPR_LETTER + 18, 3),  // S
+    OAM_SPR( 96, 150, SPR_LETTER + 2,  3),  // C
+    OAM_SPR(104, 150, SPR_LETTER + 14, 3),  // O
+    OAM_SPR(112, 150, SPR_LETTER + 17, 3),  // R
+    OAM_SPR(120, 150, SPR_LETTER + 4,  3),  // E
+    OAM_SPR(124, 165, SPR_LETTER + 15, 3),  // P
+    OAM_SPR(132, 165, SPR_LETTER + 19, 3),  // T
+    OAM_SPR(140, 165, SPR_LETTER + 18, 3)   // S
+};
 
-        // Draw START marker at bottom
-        id = set_sprite(id, 8, 208, SPR_LETTER + 18, 3);  // S (start)
+// Win: blinking "PRESS" / "START" (2 lines to avoid sprite limit)
+static const unsigned char tpl_win_press[] = {
+    OAM_SPR( 96, 192, SPR_LETTER + 15, 3),  // P
+    OAM_SPR(104, 192, SPR_LETTER + 17, 3),  // R
+    OAM_SPR(112, 192, SPR_LETTER + 4,  3),  // E
+    OAM_SPR(120, 192, SPR_LETTER + 18, 3),  // S
+    OAM_SPR(128, 192, SPR_LETTER + 18, 3),  // S
+    OAM_SPR( 96, 204, SPR_LETTER + 18, 3),  // S
+    OAM_SPR(104, 204, SPR_LETTER + 19, 3),  // T
+    OAM_SPR(112, 204, SPR_LETTER + 0,  3),  // A
+    OAM_SPR(120, 204, SPR_LETTER + 17, 3),  // R
+    OAM_SPR(128, 204, SPR_LETTER + 19, 3)   // T
+};
 
-        // Draw lap boundary markers (1/3 and 2/3 of the way)
-        // Lap 1 boundary: Y = 200 - 56 = 144
-        // Lap 2 boundary: Y = 200 - 112 = 88
-        marker_y1 = 144;  // End of lap 1
-        marker_y2 = 88;   // End of lap 2
+// Loop clear: "LOOP" (Y=60, number follows) and "OK" (Y=80)
+static const unsigned char tpl_loop_clear[] = {
+    OAM_SPR( 76, 60, SPR_LETTER + 11, 0),  // L
+    OAM_SPR( 84, 60, SPR_LETTER + 14, 0),  // O
+    OAM_SPR( 92, 60, SPR_LETTER + 14, 0),  // O
+    OAM_SPR(100, 60, SPR_LETTER + 15, 0),  // P
+    OAM_SPR(100, 80, SPR_LETTER + 14, 0),  // O
+    OAM_SPR(108, 80, SPR_LETTER + 10, 0)   // K
+};
 
-        // Show markers as small horizontal lines
-        id = set_sprite(id, 4, marker_y1, SPR_HLINE, 3);
-        id = set_sprite(id, 4, marker_y2, SPR_HLINE, 3);
-    }
+// Loop clear: blinking "START"
+static const unsigned char tpl_loop_start[] = {
+    OAM_SPR( 88, 180, SPR_LETTER + 18, 3),  // S
+    OAM_SPR( 96, 180, SPR_LETTER + 19, 3),  // T
+    OAM_SPR(104, 180, SPR_LETTER + 0,  3),  // A
+    OAM_SPR(112, 180, SPR_LETTER + 17, 3),  // R
+    OAM_SPR(120, 180, SPR_LETTER + 19, 3)   // T
+};
 
-    // Hide remaining sprites
-    while (id < 64) {
-        OAM[id * 4] = 0xFF;
-        ++id;
-    }
+// "PAUSE" overlay
+static const unsigned char tpl_pause[] = {
+    OAM_SPR( 92, 100, SPR_LETTER + 15, 3),  // P
+    OAM_SPR(100, 100, SPR_LETTER + 0,  3),  // A
+    OAM_SPR(108, 100, SPR_LETTER + 20, 3),  // U
+    OAM_SPR(116, 100, SPR_LETTER + 18, 3),  // S
+    OAM_SPR(124, 100, SPR_LETTER + 4,  3)   // E
+};
+
+// Put one sprite into the title leaderboard
+static void board_put(unsigned char x, unsigned char y, unsigned char tile, unsigned char attr) {
+    unsigned char *p = &title_board[title_board_n << 2];
+    p[0] = y;
+    p[1] = SPR_TILE(tile);
+    p[2] = attr;
+    p[3] = x;
+    ++title_board_n;
 }
 
-// Draw title screen
-static void draw_title(void) {
-    unsigned char id = 0;
-    unsigned char x = 96, y = 40;
-    unsigned char i;
-    unsigned int s;
-
-    // Version "V5.3" at top-right (4 sprites)
-    id = set_sprite(id, 216, 8, SPR_LETTER + 21, 3);  // V
-    id = set_sprite(id, 224, 8, SPR_DIGIT + 5, 3);    // 5
-    id = set_sprite(id, 232, 8, SPR_DOT, 3);          // .
-    id = set_sprite(id, 240, 8, SPR_DIGIT + 3, 3);    // 3
-
-    // "EDGE" - top line (blue, player color)
-    id = set_sprite(id, x,      y, SPR_LETTER + 4,  0);  // E
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 3,  0);  // D
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 6,  0);  // G
-    id = set_sprite(id, x + 24, y, SPR_LETTER + 4,  0);  // E
-
-    // "RACE" - bottom line, offset right (red)
-    id = set_sprite(id, x + 8,  y + 12, SPR_LETTER + 17, 1);  // R
-    id = set_sprite(id, x + 16, y + 12, SPR_LETTER + 0,  1);  // A
-    id = set_sprite(id, x + 24, y + 12, SPR_LETTER + 2,  1);  // C
-    id = set_sprite(id, x + 32, y + 12, SPR_LETTER + 4,  1);  // E
-
-    // High scores display (2 lines per entry to avoid 8-sprite limit)
-    // Line 1: Rank + Name (4 sprites, 40px wide, centered)
-    // Line 2: Score (6 sprites, 48px wide, centered)
+// Build the leaderboard sprites from the save - on the first title frame and
+// after a new high score, instead of every frame
+// 2 lines per entry to avoid the 8-sprite limit: rank + name, then the score
+static void build_title_board(void) {
+    unsigned char i, n, top, y;
+    const volatile unsigned char *s;
+
+    title_board_n = 0;
     for (i = 0; i < NUM_HIGH_SCORES; ++i) {
-        unsigned char y_base = 110 + i * 20;  // 110, 130, 150
+        y = 110 + i * 20;  // 110, 130, 150
 
         // Line 1: Rank + Name (4 sprites) - centered at X=108
-        y = y_base;
-        id = set_sprite(id, 108, y, SPR_DIGIT + i + 1, 3);  // Rank
-        id = set_sprite(id, 124, y, SPR_LETTER + high_names[i][0], 3);
-        id = set_sprite(id, 132, y, SPR_LETTER + high_names[i][1], 3);
-        id = set_sprite(id, 140, y, SPR_LETTER + high_names[i][2], 3);
-
-        // Line 2: Score (5-6 sprites) - centered at X=104
-        y = y_base + 10;
-        x = 104;
-        {
-            unsigned long full_score = ((unsigned long)high_scores_high[i] << 16) | high_scores[i];
-            if (full_score >= 1000000UL) {
-                // Large score: use scientific notation (XXXE# format, 5 sprites)
-                unsigned char exp = 0;
-                unsigned int mantissa;
-                while (full_score >= 1000UL) {
-                    full_score /= 10;
-                    exp++;
-                }
-                mantissa = (unsigned int)full_score;
-                // Display: XXX E X (5 sprites, centered)
-                x = 108;
-                id = set_sprite(id, x,      y, SPR_DIGIT + (unsigned char)(mantissa / 100), 3);
-                id = set_sprite(id, x + 8,  y, SPR_DIGIT + (unsigned char)((mantissa / 10) % 10), 3);
-                id = set_sprite(id, x + 16, y, SPR_DIGIT + (unsigned char)(mantissa % 10), 3);
-                id = set_sprite(id, x + 24, y, SPR_LETTER + 4, 2);  // E (yellow)
-                id = set_sprite(id, x + 32, y, SPR_DIGIT + exp, 2); // exponent (yellow)
-            } else if (full_score >= 100000UL) {
-                // 6-digit score: display normally
-                id = set_sprite(id, x,      y, SPR_DIGIT + (unsigned char)(full_score / 100000UL), 3);
-                id = set_sprite(id, x + 8,  y, SPR_DIGIT + (unsigned char)((full_score / 10000UL) % 10), 3);
-                id = set_sprite(id, x + 16, y, SPR_DIGIT + (unsigned char)((full_score / 1000UL) % 10), 3);
-                id = set_sprite(id, x + 24, y, SPR_DIGIT + (unsigned char)((full_score / 100UL) % 10), 3);
-                id = set_sprite(id, x + 32, y, SPR_DIGIT + (unsigned char)((full_score / 10UL) % 10), 3);
-                id = set_sprite(id, x + 40, y, SPR_DIGIT + (unsigned char)(full_score % 10), 3);
-            } else {
-                // Smaller score: display with leading zeros
-                s = (unsigned int)full_score;
-                id = set_sprite(id, x,      y, SPR_DIGIT + 0, 3);
-                id = set_sprite(id, x + 8,  y, SPR_DIGIT + (unsigned char)(s / 10000), 3);
-                id = set_sprite(id, x + 16, y, SPR_DIGIT + (unsigned char)((s / 1000) % 10), 3);
-                id = set_sprite(id, x + 24, y, SPR_DIGIT + (unsigned char)((s / 100) % 10), 3);
-                id = set_sprite(id, x + 32, y, SPR_DIGIT + (unsigned char)((s / 10) % 10), 3);
-                id = set_sprite(id, x + 40, y, SPR_DIGIT + (unsigned char)(s % 10), 3);
+        board_put(108, y, SPR_DIGIT + i + 1, 3);
+        board_put(124, y, SPR_LETTER + high_names[i][0], 3);
+        board_put(132, y, SPR_LETTER + high_names[i][1], 3);
+        board_put(140, y, SPR_LETTER + high_names[i][2], 3);
+
+        // Line 2: Score (5-6 sprites), digits read straight from the BCD save
+        y += 10;
+        s = high_scores[i];
+        top = score_top(s);
+        if (top >= 6) {
+            // Large score: use scientific notation (XXXE# format, 5 sprites)
+            board_put(108, y, SPR_DIGIT + score_digit(s, top), 3);
+            board_put(116, y, SPR_DIGIT + score_digit(s, top - 1), 3);
+            board_put(124, y, SPR_DIGIT + score_digit(s, top - 2), 3);
+            board_put(132, y, SPR_LETTER + 4, 2);         // E (yellow)
+            board_put(140, y, SPR_DIGIT + (top - 2), 2);  // exponent (yellow)
+        } else {
+            // Up to 6 digits, with leading zeros - centered at X=104
+            for (n = 0; n < 6; ++n) {
+                board_put(104 + (n << 3), y, SPR_DIGIT + score_digit(s, 5 - n), 3);
             }
         }
     }
+}
+
+// Draw title screen
+static void draw_title(void) {
+    unsigned char id;
+
+    // Version, "EDGE" / "RACE"
+    id = draw_template(0, tpl_title, TPL_LEN(tpl_title));
+
+    // High scores display (sprites built once, see build_title_board)
+    if (!title_board_n) build_title_board();
+    id = draw_template(id, title_board, title_board_n);
 
     // Loop selection (only show if player has completed at least 1 loop)
     // Positioned above high scores, centered
     if (max_loop > 0) {
-        y = 84;
-        x = 100;  // Centered: "LOOP X" is ~48px, start at 104
-        // "LOOP" label
-        id = set_sprite(id, x,      y, SPR_LETTER + 11, 3);  // L
-        id = set_sprite(id, x + 8,  y, SPR_LETTER + 14, 3);  // O
-        id = set_sprite(id, x + 16, y, SPR_LETTER + 14, 3);  // O
-        id = set_sprite(id, x + 24, y, SPR_LETTER + 15, 3);  // P
+        // "LOOP" label and up/down arrows
+        id = draw_template(id, tpl_title_loop, TPL_LEN(tpl_title_loop));
 
         // Loop number (blinking if selectable)
-        x = 136;
         if (frame_count & 0x10) {
-            id = set_sprite(id, x, y, SPR_DIGIT + title_select_loop + 1,
+            id = set_sprite(id, 136, 84, SPR_DIGIT + title_select_loop + 1,
                            title_select_loop > 0 ? 1 : 3);  // Red if loop 2+
         }
-
-        // Up/Down arrows if more than 1 option
-        if (max_loop > 0) {
-            id = set_sprite(id, x + 12, y - 6, 0x0A, 3);        // Up arrow
-            id = set_sprite(id, x + 12, y + 6, 0x0A, 3 | 0x80); // Down arrow (flipped)
-        }
     }
 
     // "START" prompt (blinking) with car icon
     // Car always visible
-    id = set_car(id, 84, 184, SPR_CAR, 0);
-
-    // START text (blinking)
+    id = draw_meta(id, 84, 184, ms_car, 0);
     if (frame_count & 0x20) {
-        y = 188;
-        x = 108;
-        id = set_sprite(id, x,      y, SPR_LETTER + 18, 2);  // S
-        id = set_sprite(id, x + 8,  y, SPR_LETTER + 19, 2);  // T
-        id = set_sprite(id, x + 16, y, SPR_LETTER + 0,  2);  // A
-        id = set_sprite(id, x + 24, y, SPR_LETTER + 17, 2);  // R
-        id = set_sprite(id, x + 32, y, SPR_LETTER + 19, 2);  // T
-    }
-
-    // "2026 FUBA" at bottom-center (no copyright symbol)
-    y = 216;
-    x = 88;  // Centered: 128 - 40 = 88
-    id = set_sprite(id, x,      y, SPR_DIGIT + 2, 3);    // 2
-    id = set_sprite(id, x + 8,  y, SPR_DIGIT + 0, 3);    // 0
-    id = set_sprite(id, x + 16, y, SPR_DIGIT + 2, 3);    // 2
-    id = set_sprite(id, x + 24, y, SPR_DIGIT + 6, 3);    // 6
-    id = set_sprite(id, x + 40, y, SPR_LETTER + 5, 3);   // F
-    id = set_sprite(id, x + 48, y, SPR_LETTER + 20, 3);  // U
-    id = set_sprite(id, x + 56, y, SPR_LETTER + 1, 3);   // B
-    id = set_sprite(id, x + 64, y, SPR_LETTER + 0, 3);   // A
-
-    // Hide rest
-    while (id < 64) {
-        OAM[id * 4] = 0xFF;
-        ++id;
+        id = draw_template(id, tpl_title_start, TPL_LEN(tpl_title_start));
     }
+
+    // "2026 FUBA" at bottom-center
+    id = draw_template(id, tpl_title_foot, TPL_LEN(tpl_title_foot));
+
+    hide_rest(id);
 }
 
 // Draw game over screen
 static void draw_gameover(void) {
-    unsigned char id = 0;
-    unsigned char x = 88, y = 100;
-
-    // "GAME" (red)
-    id = set_sprite(id, x,      y, SPR_LETTER + 6,  1);  // G
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 0,  1);  // A
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 12, 1);  // M
-    id = set_sprite(id, x + 24, y, SPR_LETTER + 4,  1);  // E
-
-    // "OVER" (red)
-    x = 96; y = 116;
-    id = set_sprite(id, x,      y, SPR_LETTER + 14, 1);  // O
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 21, 1);  // V
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 4,  1);  // E
-    id = set_sprite(id, x + 24, y, SPR_LETTER + 17, 1);  // R
-
-    // Hide rest
-    while (id < 64) {
-        OAM[id * 4] = 0xFF;
-        ++id;
-    }
+    unsigned char id;
+
+    // "GAME" / "OVER" (red)
+    id = draw_template(0, tpl_gameover, TPL_LEN(tpl_gameover));
+
+    hide_rest(id);
 }
 
 // Initialize win animation
@@ -2597,40 +3538,15 @@ static void update_win_animation(void) {
 static void draw_highscore_entry(void) {
     unsigned char id = 0;
     unsigned char x, y, i;
-    unsigned int s;
 
     // "NEW HIGH SCORE!" (split to 2 lines for sprite limit)
-    x = 72;
-    y = 40;
-    id = set_sprite(id, x,      y, SPR_LETTER + 13, 0);  // N
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 4,  0);  // E
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 22, 0);  // W
-
-    x = 68;
-    y = 56;
-    id = set_sprite(id, x,      y, SPR_LETTER + 7,  0);  // H
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 8,  0);  // I
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 6,  0);  // G
-    id = set_sprite(id, x + 24, y, SPR_LETTER + 7,  0);  // H
+    id = draw_template(id, tpl_hs_head, TPL_LEN(tpl_hs_head));
 
     // Score value
-    x = 96;
-    y = 80;
-    s = score;
-    if (s > 99999) s = 99999;
-    id = set_sprite(id, x,      y, SPR_DIGIT + (unsigned char)(s / 10000), 3);
-    id = set_sprite(id, x + 8,  y, SPR_DIGIT + (unsigned char)((s / 1000) % 10), 3);
-    id = set_sprite(id, x + 16, y, SPR_DIGIT + (unsigned char)((s / 100) % 10), 3);
-    id = set_sprite(id, x + 24, y, SPR_DIGIT + (unsigned char)((s / 10) % 10), 3);
-    id = set_sprite(id, x + 32, y, SPR_DIGIT + (unsigned char)(s % 10), 3);
-
-    // "ENTER NAME" (on 2 lines)
-    x = 88;
-    y = 110;
-    id = set_sprite(id, x,      y, SPR_LETTER + 13, 3);  // N
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 0,  3);  // A
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 12, 3);  // M
-    id = set_sprite(id, x + 24, y, SPR_LETTER + 4,  3);  // E
+    id = draw_score5(id, 96, 80);
+
+    // "ENTER NAME"
+    id = draw_template(id, tpl_hs_name, TPL_LEN(tpl_hs_name));
 
     // Name entry display (3 letters)
     x = 104;
@@ -2642,35 +3558,20 @@ static void draw_highscore_entry(void) {
 
         // Draw cursor under current position (blinking, yellow)
         if (i == name_entry_pos && (frame_count & 0x10)) {
-            id = set_sprite(id, x + i * 16, y + 10, SPR_BAR_FILL, 2);
+            id = set_sprite(id, x + i * 16, y + 10, SPR_CURSOR, 2);
         }
     }
 
-    // Up/Down arrows hint
-    x = 80;
-    y = 140;
-    id = set_sprite(id, x, y - 4, 0x0A, 0);  // Up arrow (rotated)
-    id = set_sprite(id, x, y + 8, 0x0A, 0 | 0x80);  // Down arrow
+    // Up/Down arrows and "A=OK" hint
+    id = draw_template(id, tpl_hs_hint, TPL_LEN(tpl_hs_hint));
 
-    // "A=OK" hint
-    y = 190;
-    x = 104;
-    id = set_sprite(id, x,      y, SPR_LETTER + 0, 3);   // A
-    id = set_sprite(id, x + 12, y, SPR_LETTER + 14, 3);  // O
-    id = set_sprite(id, x + 20, y, SPR_LETTER + 10, 3);  // K
-
-    // Hide remaining sprites
-    while (id < 64) {
-        OAM[id * 4] = 0xFF;
-        ++id;
-    }
+    hide_rest(id);
 }
 
 // Draw win screen with celebration animation
 static void draw_win(void) {
     unsigned char id = 0;
     unsigned char x, y;
-    unsigned int s;
     unsigned char i;
     unsigned char text_y;
     unsigned char bounce;
@@ -2702,76 +3603,29 @@ static void draw_win(void) {
     id = set_sprite(id, x + 40, text_y, SPR_LETTER + 7,  0);  // H
 
     // === "1ST PLACE" ===
-    y = 90;
-    x = 88;
-    id = set_sprite(id, x,      y, SPR_DIGIT + 1, 3);         // 1
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 18, 3);       // S
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 19, 3);       // T
-
-    x = 116;
-    id = set_sprite(id, x,      y, SPR_LETTER + 15, 3);       // P
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 11, 3);       // L
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 0,  3);       // A
-    id = set_sprite(id, x + 24, y, SPR_LETTER + 2,  3);       // C
-    id = set_sprite(id, x + 32, y, SPR_LETTER + 4,  3);       // E
+    id = draw_template(id, tpl_win_place, TPL_LEN(tpl_win_place));
 
     // === Animated player car (spinning/celebrating) ===
     y = 115;
     x = 112;
     if (frame_count & 0x10) {
         // Car facing forward
-        id = set_car(id, x, y, SPR_CAR, 0);
+        id = draw_meta(id, x, y, ms_car, 0);
     } else {
         // Car tilted (using different attributes for flip effect)
-        id = set_car(id, x, y, SPR_CAR, 0 | 0x40);  // H-flip
-    }
-
-    // === SCORE display ===
-    y = 150;
-    x = 88;
-    id = set_sprite(id, x,      y, SPR_LETTER + 18, 3);  // S
-    id = set_sprite(id, x + 8,  y, SPR_LETTER + 2,  3);  // C
-    id = set_sprite(id, x + 16, y, SPR_LETTER + 14, 3);  // O
-    id = set_sprite(id, x + 24, y, SPR_LETTER + 17, 3);  // R
-    id = set_sprite(id, x + 32, y, SPR_LETTER + 4,  3);  // E
-
-    // Score value (5 digits)
-    y = 165;
-    x = 80;
-    s = score;
-    if (s > 99999) s = 99999;  // Cap at 5 digits
-    id = set_sprite(id, x,      y, SPR_DIGIT + (unsigned char)(s / 10000), 3);
-    id = set_sprite(id, x + 8,  y, SPR_DIGIT + (unsigned char)((s / 1000) % 10), 3);
-    id = set_sprite(id, x + 16, y, SPR_DIGIT + (unsigned char)((s / 100) % 10), 3);
-    id = set_sprite(id, x + 24, y, SPR_DIGIT + (unsigned char)((s / 10) % 10), 3);
-    id = set_sprite(id, x + 32, y, SPR_DIGIT + (unsigned char)(s % 10), 3);
-    id = set_sprite(id, x + 44, y, SPR_LETTER + 15, 3);  // P
-    id = set_sprite(id, x + 52, y, SPR_LETTER + 19, 3);  // T (PTS)
-    id = set_sprite(id, x + 60, y, SPR_LETTER + 18, 3);  // S
-
-    // === "PRESS" / "START" blinking prompt (2 lines to avoid sprite limit) ===
+        id = draw_meta(id, x, y, ms_car, 0x40);  // H-flip
+    }
+
+    // === SCORE display: label, value (5 digits), "PTS" ===
+    id = draw_score5(id, 80, 165);  // Cap at 5 digits
+    id = draw_template(id, tpl_win_score, TPL_LEN(tpl_win_score));
+
+    // === "PRESS" / "START" blinking prompt ===
     if (win_timer > 90 && (frame_count & 0x20)) {
-        x = 96;
-        y = 192;
-        id = set_sprite(id, x,      y, SPR_LETTER + 15, 3);  // P
-        id = set_sprite(id, x + 8,  y, SPR_LETTER + 17, 3);  // R
-        id = set_sprite(id, x + 16, y, SPR_LETTER + 4,  3);  // E
-        id = set_sprite(id, x + 24, y, SPR_LETTER + 18, 3);  // S
-        id = set_sprite(id, x + 32, y, SPR_LETTER + 18, 3);  // S
-
-        y = 204;
-        id = set_sprite(id, x,      y, SPR_LETTER + 18, 3);  // S
-        id = set_sprite(id, x + 8,  y, SPR_LETTER + 19, 3);  // T
-        id = set_sprite(id, x + 16, y, SPR_LETTER + 0,  3);  // A
-        id = set_sprite(id, x + 24, y, SPR_LETTER + 17, 3);  // R
-        id = set_sprite(id, x + 32, y, SPR_LETTER + 19, 3);  // T
-    }
-
-    // Hide remaining sprites
-    while (id < 64) {
-        OAM[id * 4] = 0xFF;
-        ++id;
+        id = draw_template(id, tpl_win_press, TPL_LEN(tpl_win_press));
     }
+
+    hide_rest(id);
 }
 
 // Draw loop clear celebration screen (simplified to save ROM)
@@ -2784,51 +3638,31 @@ static void draw_loop_clear(void) {
         id = set_sprite(id, confetti_x[i], confetti_y[i], SPR_BULLET, confetti_color[i]);
     }
 
-    // "LOOP" "X" (Y=60)
-    id = set_sprite(id, 76,  60, SPR_LETTER + 11, 0);  // L
-    id = set_sprite(id, 84,  60, SPR_LETTER + 14, 0);  // O
-    id = set_sprite(id, 92,  60, SPR_LETTER + 14, 0);  // O
-    id = set_sprite(id, 100, 60, SPR_LETTER + 15, 0);  // P
+    // "LOOP" "X" (Y=60), "OK" (Y=80)
+    id = draw_template(id, tpl_loop_clear, TPL_LEN(tpl_loop_clear));
     id = set_sprite(id, 112, 60, SPR_DIGIT + loop_count, 2);  // yellow
 
-    // "OK" (Y=80)
-    id = set_sprite(id, 100, 80, SPR_LETTER + 14, 0);  // O
-    id = set_sprite(id, 108, 80, SPR_LETTER + 10, 0);  // K
-
     // Car
-    id = set_car(id, 112, 100, SPR_CAR, (frame_count & 0x10) ? 0 : 0x40);
+    id = draw_meta(id, 112, 100, ms_car, (frame_count & 0x10) ? 0 : 0x40);
 
     // "START" blinking (after 60 frames)
     if (loop_clear_timer > 60 && (frame_count & 0x20)) {
-        id = set_sprite(id, 88, 180, SPR_LETTER + 18, 3);   // S
-        id = set_sprite(id, 96, 180, SPR_LETTER + 19, 3);   // T
-        id = set_sprite(id, 104, 180, SPR_LETTER + 0, 3);   // A
-        id = set_sprite(id, 112, 180, SPR_LETTER + 17, 3);  // R
-        id = set_sprite(id, 120, 180, SPR_LETTER + 19, 3);  // T
+        id = draw_template(id, tpl_loop_start, TPL_LEN(tpl_loop_start));
     }
 
-    // Hide rest
-    while (id < 64) {
-        OAM[id * 4] = 0xFF;
-        ++id;
-    }
+    hide_rest(id);
 }
 
 // Draw pause screen
 static void draw_pause(void) {
-    unsigned char id = 0;
-    unsigned char x = 92, y = 100;
-
     // Draw game in background first
     draw_game();
 
-    // "PAUSE" text overlay (blinking)
+    // "PAUSE" text overlay (blinking) - pinned slots 1-5 only, which
+    // draw_game rewrites every frame, so hide_rest's mark stays valid and
+    // sprite 0 keeps the HUD split
     if (frame_count & 0x10) {
-        id = set_sprite(id, x,      y, SPR_LETTER + 15, 3);  // P
-        id = set_sprite(id, x + 8,  y, SPR_LETTER + 0,  3);  // A
-        id = set_sprite(id, x + 16, y, SPR_LETTER + 20, 3);  // U
-        id = set_sprite(id, x + 24, y, SPR_LETTER + 18, 3);  // S
-        id = set_sprite(id, x + 32, y, SPR_LETTER + 4,  3);  // E
+        draw_template(1, tpl_pause, TPL_LEN(tpl_pause));
     }
 }
 
@@ -2837,6 +3671,8 @@ void main(void) {
     // Initialize
     rnd_seed = 42;
     game_state = STATE_TITLE;
+    spr_limit = 64;  // No sprite budget outside draw_game
+    oam_hw = 64;     // First OAM build hides every sprite
 
     // Initialize battery-backed save data
     init_save();
@@ -2852,20 +3688,31 @@ void main(void) {
     init_apu();
     music_play(0);  // Title BGM
 
-    // Load palettes
+    // Load palettes (title fades in from black)
     load_palettes();
+    pal_set_bright(0);
+    pal_fade(PAL_NORMAL, 3);
 
-    // Draw initial road (then clear center line for title screen)
-    draw_road();
-    clear_center_line();
+    // HUD strip nametable ($2400): static frame, hud_update() fills it in
+    ppu_addr(0x2400);
+    vram_unrle(nt_hud);
+
+    // Draw the title road (no center line)
+    draw_road(nt_title);
 
     // Enable NMI and rendering
-    PPU_CTRL = 0x88;  // NMI on, sprites at $1000
+    ppu_ctrl_shadow = PPU_CTRL_ON;
+    PPU_CTRL = ppu_ctrl_shadow;
     nmi_enabled = 1;  // Allow wait_vblank to use NMI flag
     ppu_on();
 
     // Main loop
     while (1) {
+        unsigned char race_frame;
+
+        // Frame work starts here (debug CPU meter band begins)
+        cpu_meter_on();
+
         // Read controller first (before vblank for responsive input)
         pad_old = pad_now;
         pad_now = read_pad();
@@ -2873,9 +3720,11 @@ void main(void) {
 
         ++frame_count;
         rnd_seed ^= frame_count;
+        race_frame = (game_state == STATE_RACING);
 
-        // Clear sprites and build OAM buffer BEFORE vblank
-        clear_sprites();
+        // Build OAM buffer BEFORE vblank (each screen ends with hide_rest)
+        // Only draw_game shows the HUD strip
+        ppu_split = 0;
 
         // Music is updated in NMI handler for stable timing
         // (no music_update call here)
@@ -2908,6 +3757,9 @@ void main(void) {
                 break;
 
             case STATE_RACING:
+                if (pad_new & BTN_SELECT) {
+                    debug_hud ^= 1;  // Toggle lag readout
+                }
                 if (pad_new & BTN_START) {
                     game_state = STATE_PAUSED;
                     music_pause();
@@ -2933,37 +3785,14 @@ void main(void) {
                 // Show explosion animation (HP=0 death)
                 ++explode_timer;
                 {
-                    unsigned char id = 0;
-                    unsigned char ex, ey;
+                    unsigned char id;
                     unsigned char phase = explode_timer >> 3;  // Every 8 frames
 
-                    // Center explosion
-                    id = set_sprite(id, explode_x + 4, explode_y + 4, SPR_EXPLOSION, 2);
-
-                    // Expanding explosions around center
-                    if (phase >= 1) {
-                        ex = explode_x - 4;
-                        ey = explode_y - 4;
-                        id = set_sprite(id, ex, ey, SPR_EXPLOSION, 2);
-                        id = set_sprite(id, ex + 16, ey, SPR_EXPLOSION, 2);
-                    }
-                    if (phase >= 2) {
-                        ex = explode_x - 8;
-                        ey = explode_y + 4;
-                        id = set_sprite(id, ex, ey, SPR_EXPLOSION, 2);
-                        id = set_sprite(id, ex + 24, ey, SPR_EXPLOSION, 2);
-                    }
-                    if (phase >= 3) {
-                        ey = explode_y + 12;
-                        id = set_sprite(id, explode_x - 4, ey, SPR_EXPLOSION, 2);
-                        id = set_sprite(id, explode_x + 12, ey, SPR_EXPLOSION, 2);
-                    }
+                    // Center explosion, then expanding rings around it
+                    if (phase > 3) phase = 3;
+                    id = draw_meta(0, explode_x, explode_y, ms_explode[phase], 2);
 
-                    // Hide remaining sprites
-                    while (id < 64) {
-                        OAM[id * 4] = 0xFF;
-                        ++id;
-                    }
+                    hide_rest(id);
                 }
                 // After ~1 second, move to next state
                 if (explode_timer > 60) {
@@ -2979,10 +3808,7 @@ void main(void) {
                     unsigned char x, y;
 
                     // Draw player car (stopped)
-                    id = set_sprite(id, player_x,     player_y,     SPR_CAR,     0);
-                    id = set_sprite(id, player_x + 8, player_y,     SPR_CAR + 1, 0);
-                    id = set_sprite(id, player_x,     player_y + 8, SPR_CAR + 2, 0);
-                    id = set_sprite(id, player_x + 8, player_y + 8, SPR_CAR + 3, 0);
+                    id = draw_meta(id, player_x, player_y, ms_car, 0);
 
                     // Show position (e.g., "2ND" or "3RD") in yellow
                     x = 96;
@@ -3000,19 +3826,9 @@ void main(void) {
                     }
 
                     // "PLACE" below (yellow)
-                    x = 88;
-                    y = 116;
-                    id = set_sprite(id, x,      y, SPR_LETTER + 15, 2);  // P
-                    id = set_sprite(id, x + 8,  y, SPR_LETTER + 11, 2);  // L
-                    id = set_sprite(id, x + 16, y, SPR_LETTER + 0,  2);  // A
-                    id = set_sprite(id, x + 24, y, SPR_LETTER + 2,  2);  // C
-                    id = set_sprite(id, x + 32, y, SPR_LETTER + 4,  2);  // E
-
-                    // Hide remaining sprites
-                    while (id < 64) {
-                        OAM[id * 4] = 0xFF;
-                        ++id;
-                    }
+                    id = draw_template(id, tpl_place, TPL_LEN(tpl_place));
+
+                    hide_rest(id);
                 }
                 // After ~1.5 seconds, move to next state
                 if (explode_timer > 90) {
@@ -3055,6 +3871,7 @@ void main(void) {
                     boost_active = 0;
                     boss_music_active = 0; // No boss at loop start
                     enemy_next_rank = 11;  // Reset enemy ranks for new loop
+                    reset_lag_stats();
                     {
                         unsigned char j;
                         for (j = 0; j < MAX_ENEMIES; ++j) enemy_on[j] = 0;
@@ -3064,7 +3881,9 @@ void main(void) {
                     ppu_off();
                     load_palettes();
                     update_loop_palette();  // Override road/grass colors based on loop_count
-                    draw_road();
+                    pal_set_bright(0);      // New loop colors fade in from black
+                    pal_fade(PAL_NORMAL, 3);
+                    draw_road(nt_race);
 
                     // Resume racing BGM with moderate intensity for LAP 1
                     music_play(TRACK_RACING);
@@ -3097,8 +3916,8 @@ void main(void) {
                 if (pad_new & BTN_A) {
                     ++name_entry_pos;
                     if (name_entry_pos >= 3) {
-                        // Done entering name - save score (32-bit)
-                        insert_high_score(new_score_rank, score_high, score);
+                        // Done entering name - save score
+                        insert_high_score(new_score_rank);
                         game_state = STATE_GAMEOVER;
                     } else {
                         // Move to next letter
@@ -3107,21 +3926,25 @@ void main(void) {
                 }
                 // START button to finish name entry immediately
                 if (pad_new & BTN_START) {
-                    insert_high_score(new_score_rank, score_high, score);
+                    insert_high_score(new_score_rank);
                     game_state = STATE_GAMEOVER;
                 }
                 break;
         }
 
-        // Wait for vblank AFTER building OAM buffer
-        wait_vblank();
+        // Lag detection - only for frames that raced from start to end
+        // (state transitions redraw the nametable and always overrun)
+        if (race_frame && game_state == STATE_RACING) {
+            count_lag();
+        }
+
+        // Palette fade / upload first: it must not wait behind the wipe
+        pal_update();
 
-        // OAM DMA - now transfers current frame's sprites
-        OAM_ADDR = 0;
-        OAM_DMA = 0x02;
+        // Title road: next rows of the center line wipe
+        if (road_clear_row < 30) road_clear_step();
 
-        // Set scroll
-        PPU_SCROLL = 0;
-        PPU_SCROLL = scroll_y;
+        // Hand the frame to the NMI (sprite DMA, VRAM queue, scroll)
+        present_frame();
     }
 }
@@ -0,0 +1,163 @@
+; OAM writers - ROM templates and metasprites straight into the OAM page
+;
+; unsigned char __fastcall__ oam_blit(unsigned char id);
+;   A = first sprite id, returns the next free sprite id
+;   oam_src / oam_n: template address and sprite count (set by draw_template
+;   in main.c). Copies to OAM in plain order (screens with oam_rot = 0),
+;   clipped at sprite 63
+;
+; The source pointer is biased by the destination offset so one index
+; register walks both buffers: (ptr1),Y reads src + (Y - offset).
+;
+; unsigned char __fastcall__ oam_meta(unsigned char id);
+;   A = first sprite id, returns the next free sprite id
+;   oam_src: metasprite, records (dy, tile, attr, dx) ended by META_END ($80)
+;   oam_mx / oam_my: position, oam_attr: ORed into each record's attribute
+;   oam_off: OAM byte offset of sprite id (rotated slot, see oam_slot)
+;   oam_lim: first id not allowed (spr_limit); records past it are shed and
+;   counted in oam_n
+;
+; X holds the running OAM offset, wrapping past sprite 63 to OAM_PINNED
+; like the bullet kernel, so rotated slots cost nothing per record.
+
+.export _oam_blit, _oam_meta
+.export _oam_src, _oam_n
+.export _oam_mx, _oam_my, _oam_attr, _oam_off, _oam_lim
+
+.importzp ptr1
+
+; Must match main.c
+OAM         = $0200             ; OAM buffer
+OAM_PINNED  = 6                 ; OAM 0-5 never rotate (split sprite, player car + hitbox)
+META_END    = $80               ; dy of the terminator record
+
+.segment "BSS"
+
+; Inputs
+_oam_src:    .res 2             ; Template address
+_oam_n:      .res 1             ; Sprites to copy (oam_meta: out, records shed)
+_oam_mx:     .res 1             ; Metasprite X
+_oam_my:     .res 1             ; Metasprite Y
+_oam_attr:   .res 1             ; Attribute bits ORed into every record
+_oam_off:    .res 1             ; OAM byte offset of the first sprite
+_oam_lim:    .res 1             ; Sprite id limit
+; Working variables
+ob_id:       .res 1             ; First sprite id
+ob_end:      .res 1             ; OAM offset to stop at (0 = end of OAM)
+
+.segment "CODE"
+
+_oam_blit:
+    sta ob_id
+    lda #64                     ; Clip to the sprites left in OAM
+    sec
+    sbc ob_id
+    cmp _oam_n
+    bcs @fits
+    sta _oam_n
+@fits:
+    lda _oam_n
+    beq @done
+
+    asl a                       ; End offset = (id + n) * 4, 256 wraps to 0
+    asl a
+    sta ob_end
+    lda ob_id
+    asl a
+    asl a
+    tay                         ; Y = destination offset
+    clc
+    adc ob_end
+    sta ob_end
+    sty ptr1                    ; ptr1 = src - offset
+    lda _oam_src
+    sec
+    sbc ptr1
+    sta ptr1
+    lda _oam_src+1
+    sbc #0
+    sta ptr1+1
+
+@copy:                          ; One sprite per pass
+    lda (ptr1), y
+    sta OAM, y
+    iny
+    lda (ptr1), y
+    sta OAM, y
+    iny
+    lda (ptr1), y
+    sta OAM, y
+    iny
+    lda (ptr1), y
+    sta OAM, y
+    iny
+    cpy ob_end
+    bne @copy
+
+    lda ob_id
+    clc
+    adc _oam_n
+    ldx #0
+    rts
+
+@done:
+    lda ob_id
+    ldx #0
+    rts
+
+_oam_meta:
+    sta ob_id
+    lda _oam_src
+    sta ptr1
+    lda _oam_src+1
+    sta ptr1+1
+    lda #0
+    sta _oam_n
+    tay                         ; Y = metasprite offset
+
+@rec:
+    lda (ptr1), y               ; dy
+    cmp #META_END
+    beq @meta_done
+    ldx ob_id                   ; Out of budget: shed the rest
+    cpx _oam_lim
+    bcs @shed
+    ldx _oam_off                ; X = OAM offset
+    clc
+    adc _oam_my
+    sta OAM, x
+    iny
+    lda (ptr1), y               ; Tile (already SPR_TILE mapped)
+    sta OAM+1, x
+    iny
+    lda (ptr1), y
+    ora _oam_attr
+    sta OAM+2, x
+    iny
+    lda (ptr1), y               ; dx
+    clc
+    adc _oam_mx
+    sta OAM+3, x
+    iny
+    inc ob_id
+    txa                         ; Next slot, wrapping past 63 to OAM_PINNED
+    clc
+    adc #4
+    bne @offok
+    lda #OAM_PINNED*4
+@offok:
+    sta _oam_off
+    jmp @rec
+
+@shed:
+    inc _oam_n
+    iny
+    iny
+    iny
+    iny
+    bne @rec                    ; Always taken (metasprites are < 64 records)
+
+@meta_done:
+    lda ob_id
+    ldx #0
+    rts
@@ -0,0 +1,264 @@
+; Score arithmetic - packed BCD, the 2A03 has no decimal mode
+;
+; void __fastcall__ score_add(unsigned int points);
+;   AX = points; score += points * sc_times * 2^sc_shift
+;   sc_times / sc_shift are set by add_score() in main.c
+;   Saturates at 999999999999 instead of wrapping
+;
+; score[] is SCORE_BYTES packed BCD bytes, least significant first
+; (score[0] = tens:ones), so the HUD and the save block read digits directly.
+; The amount is built with shifts and adds only: points * times in 24-bit
+; binary, double dabble (shift-and-add-3) into BCD, then sc_shift BCD
+; doublings. Leading zero bits are skipped, so a small graze costs a few
+; conversion steps.
+
+.export _score_add
+.export _sc_times, _sc_shift
+
+.import _score
+
+; Must match main.c
+SCORE_BYTES = 6                 ; 12 digits
+
+.segment "BSS"
+
+; Inputs
+_sc_times:   .res 1             ; Binary factor (0 adds nothing)
+_sc_shift:   .res 1             ; BCD doublings after the multiply
+; Working variables
+sc_bin:      .res 3             ; points * times, 24-bit binary
+sc_mul:      .res 3             ; points << k during the multiply
+sc_t:        .res 1             ; Factor bits not used yet
+sc_acc:      .res SCORE_BYTES   ; Amount to add, packed BCD
+sc_n:        .res 1             ; Top BCD byte in use (conversion), bytes to add
+sc_lo:       .res 1             ; Low digit of the byte being added
+sc_c:        .res 1             ; Decimal carry (0/1)
+
+.segment "CODE"
+
+_score_add:
+    sta sc_mul
+    stx sc_mul+1
+    lda #0
+    sta sc_mul+2
+    sta sc_bin
+    sta sc_bin+1
+    sta sc_bin+2
+    lda _sc_times
+    sta sc_t
+
+    ; sc_bin = points * times (binary shift-and-add, fits 24 bits)
+@mul:
+    lsr sc_t
+    bcc @mul_next
+    clc
+    lda sc_bin
+    adc sc_mul
+    sta sc_bin
+    lda sc_bin+1
+    adc sc_mul+1
+    sta sc_bin+1
+    lda sc_bin+2
+    adc sc_mul+2
+    sta sc_bin+2
+@mul_next:
+    asl sc_mul
+    rol sc_mul+1
+    rol sc_mul+2
+    lda sc_t
+    bne @mul
+
+    ldx #SCORE_BYTES-1          ; A = 0 here
+@clear:
+    sta sc_acc, x
+    dex
+    bpl @clear
+
+    ; Skip leading zero bytes, then leading zero bits
+    ldy #24
+@skip_byte:
+    lda sc_bin+2
+    bne @skip
+    lda sc_bin+1
+    sta sc_bin+2
+    lda sc_bin
+    sta sc_bin+1
+    lda #0
+    sta sc_bin
+    tya
+    sec
+    sbc #8
+    tay
+    bne @skip_byte
+    rts                         ; Nothing to add
+@skip:
+    lda sc_bin+2
+    bmi @dd_len
+    asl sc_bin
+    rol sc_bin+1
+    rol sc_bin+2
+    dey
+    bne @skip                   ; Always taken (sc_bin+2 was non-zero)
+
+    ; Y bits left: only adjust the BCD bytes they can reach
+@dd_len:
+    ldx #0
+    cpy #7                      ; < 64: 2 digits
+    bcc @dd_go
+    inx
+    cpy #14                     ; < 16384: 4 digits
+    bcc @dd_go
+    inx
+    cpy #20                     ; < 1048576: 6 digits
+    bcc @dd_go
+    inx
+@dd_go:
+    stx sc_n
+
+    ; Double dabble: remaining bits into 8 BCD digits (sc_acc 0-3)
+@dd:
+    ldx sc_n
+    jsr bcd_adjust
+    asl sc_bin
+    rol sc_bin+1
+    rol sc_bin+2
+    rol sc_acc
+    rol sc_acc+1
+    rol sc_acc+2
+    rol sc_acc+3
+    dey
+    bne @dd
+
+    ; Scale: one BCD doubling per shift, a digit carried out of the top = full
+    ldy _sc_shift
+    beq @add
+@scale:
+    ldx #SCORE_BYTES-1
+    jsr bcd_adjust
+    asl sc_acc
+    rol sc_acc+1
+    rol sc_acc+2
+    rol sc_acc+3
+    rol sc_acc+4
+    rol sc_acc+5
+    bcs @full
+    dey
+    bne @scale
+    beq @add                    ; Always taken
+
+    ; Past 999999999999: saturate
+@full:
+    lda #$99
+    ldx #SCORE_BYTES-1
+@sat:
+    sta _score, x
+    dex
+    bpl @sat
+    rts
+
+    ; score += sc_acc, one digit at a time, up to its top non-zero byte
+@add:
+    ldx #SCORE_BYTES-1
+@top:
+    lda sc_acc, x
+    bne @top_ok
+    dex
+    bne @top
+@top_ok:
+    inx
+    stx sc_n
+    ldx #0
+    stx sc_c
+@add_byte:
+    lda _score, x
+    and #$0F
+    sta sc_lo
+    lda sc_acc, x
+    and #$0F
+    clc
+    adc sc_lo
+    adc sc_c                    ; 0-19, carry clear
+    ldy #0
+    cmp #10
+    bcc @lo_ok
+    sbc #10                     ; Carry set: no borrow
+    iny
+@lo_ok:
+    sta sc_lo
+    sty sc_c
+    lda _score, x
+    lsr a
+    lsr a
+    lsr a
+    lsr a
+    clc
+    adc sc_c
+    sta sc_c
+    lda sc_acc, x
+    lsr a
+    lsr a
+    lsr a
+    lsr a
+    clc
+    adc sc_c
+    ldy #0
+    cmp #10
+    bcc @hi_ok
+    sbc #10
+    iny
+@hi_ok:
+    asl a
+    asl a
+    asl a
+    asl a
+    ora sc_lo
+    sta _score, x
+    sty sc_c
+    inx
+    cpx sc_n
+    bne @add_byte
+
+    ; Ripple the carry into the higher bytes
+@carry:
+    lda sc_c
+    beq @done
+    cpx #SCORE_BYTES            ; Carry out of the top digit: saturate
+    beq @full
+    lda _score, x
+    cmp #$99
+    bne @inc
+    lda #0
+    sta _score, x
+    inx
+    bne @carry                  ; Always taken
+@inc:
+    and #$0F
+    cmp #9
+    lda _score, x
+    bcs @inc9
+    adc #1                      ; Carry clear
+    bcc @inc_store              ; Always taken
+@inc9:
+    adc #7-1                    ; Carry set: adds 7, x9 -> (x+1)0
+@inc_store:
+    sta _score, x
+@done:
+    rts
+
+; Add 3 to every digit >= 5 in sc_acc[0..X] (one double dabble step)
+bcd_adjust:
+    lda sc_acc, x
+    and #$0F
+    cmp #5
+    lda sc_acc, x
+    bcc @hi
+    adc #3-1                    ; Carry set: adds 3
+@hi:
+    cmp #$50
+    bcc @store
+    adc #$30-1                  ; Carry set: adds $30
+@store:
+    sta sc_acc, x
+    dex
+    bpl bcd_adjust
+    rts
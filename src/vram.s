@@ -0,0 +1,130 @@
+; VRAM update queue - nametable, attribute and palette writes in vblank
+;
+; void __fastcall__ vram_flush(void);
+;   Writes every queued entry to the PPU and empties the queue. Called by
+;   the NMI with a finished frame, and by main.c with rendering off
+;
+; Entries are filled by vram_run() / vram_fill() in main.c:
+;   +0  PPU address high byte | flags (VRAM_FILL $80, VRAM_DOWN $40)
+;   +1  PPU address low byte
+;   +2  count (1-255)
+;   +3  count bytes, or one byte repeated count times (VRAM_FILL)
+; VRAM_DOWN sets the PPU_CTRL +32 increment, so a run goes down a column.
+; vram_cost bounds the PPU writes per vblank; a run byte costs about 15
+; cycles, a fill byte 9.
+;
+; void __fastcall__ vram_unrle(const unsigned char *data);
+;   AX = RLE stream (tools/generate_nametables.py); writes it to PPU_DATA
+;   from the current PPU address. Rendering must be off. Format: tag byte,
+;   then values; tag, n repeats the last value n more times; tag, 0 ends
+
+.export _vram_flush, _vram_unrle
+.export _vram_buf, _vram_len, _vram_cost
+
+.import _ppu_ctrl_shadow
+.importzp ptr1
+
+; Must match main.c
+VRAM_BUF_SIZE = 96
+VRAM_FILL_HI  = $80             ; High byte flags
+VRAM_DOWN_HI  = $40
+
+PPU_CTRL   = $2000
+PPU_STATUS = $2002
+PPU_ADDR   = $2006
+PPU_DATA   = $2007
+PPU_INC32  = $04                ; PPU_CTRL: +32 increment
+
+.segment "BSS"
+
+_vram_buf:   .res VRAM_BUF_SIZE ; Queued entries
+_vram_len:   .res 1             ; Bytes queued
+_vram_cost:  .res 1             ; PPU writes queued
+vf_hi:       .res 1             ; Current entry's high byte + flags
+ur_tag:      .res 1             ; RLE tag byte
+ur_last:     .res 1             ; Last value written
+
+.segment "CODE"
+
+_vram_flush:
+    bit PPU_STATUS              ; Reset the address latch
+    ldx #0
+@entry:
+    cpx _vram_len
+    bcs @done
+    lda _vram_buf, x
+    sta vf_hi
+    and #VRAM_DOWN_HI           ; Increment for this entry
+    beq @across
+    lda #PPU_INC32
+@across:
+    ora _ppu_ctrl_shadow
+    sta PPU_CTRL
+    lda vf_hi
+    and #$3F
+    sta PPU_ADDR
+    lda _vram_buf+1, x
+    sta PPU_ADDR
+    ldy _vram_buf+2, x          ; Y = count
+    inx
+    inx
+    inx
+    bit vf_hi
+    bmi @fill
+@run:
+    lda _vram_buf, x
+    sta PPU_DATA
+    inx
+    dey
+    bne @run
+    beq @entry                  ; Always taken
+@fill:
+    lda _vram_buf, x
+    inx
+@fill_byte:
+    sta PPU_DATA
+    dey
+    bne @fill_byte
+    beq @entry                  ; Always taken
+
+@done:
+    lda #0
+    sta _vram_len
+    sta _vram_cost
+    lda _ppu_ctrl_shadow        ; Back to +1 increment
+    sta PPU_CTRL
+    rts
+
+_vram_unrle:
+    sta ptr1
+    stx ptr1+1
+    ldy #0
+    lda (ptr1), y
+    sta ur_tag
+@next:
+    iny                         ; Y walks the page, ptr1+1 the pages
+    bne @read
+    inc ptr1+1
+@read:
+    lda (ptr1), y
+    cmp ur_tag
+    beq @repeat
+    sta PPU_DATA
+    sta ur_last
+    jmp @next
+@repeat:
+    iny
+    bne @count
+    inc ptr1+1
+@count:
+    lda (ptr1), y
+    beq @end
+    tax
+    lda ur_last
+@fill:
+    sta PPU_DATA
+    dex
+    bne @fill
+    beq @next                   ; Always taken
+@end:
+    rts
@@ -153,6 +153,19 @@ TILE_HLINE = [
     "00000000",
 ]
 
+# Tile 0x0C: Lap boundary on the HUD progress bar
+# The full bottom row continues the bar outline (sprite 0 hit anchor)
+TILE_LAP_MARK = [
+    "00011000",
+    "00011000",
+    "00011000",
+    "00011000",
+    "00011000",
+    "00011000",
+    "00011000",
+    "11111111",
+]
+
 # Tiles 0x10-0x19: Digits 0-9
 DIGITS = [
     # 0
@@ -728,6 +741,19 @@ ARROW_UP = [
     "00333000",
 ]
 
+# Wall hazard on the road (background tile, road palette)
+# Black-rimmed white diamond on road gray
+TILE_WALL = [
+    "11100111",
+    "11033011",
+    "10333301",
+    "03333330",
+    "03333330",
+    "10333301",
+    "11033011",
+    "11100111",
+]
+
 # Bullet sprite (small diamond shape - danmaku style)
 # Center 4x4 area is white (color 3) to show hitbox
 BULLET = [
@@ -950,12 +976,48 @@ PUDDLE_33 = [
 ]
 
 
+# 8x16 sprite mode: cars are two column pairs (TL over BL, TR over BR)
+CAR_BASES = (0x00, 0x04, 0x60)
+BULLET_PAIR = 0x64  # 0x64-0x6B: two bullets 1-8 px apart (SPR_BULLET_PAIR)
+
+
+def bullet_pair(dy):
+    """16-row image of two BULLETs, the second dy pixels below the first"""
+    rows = ["00000000"] * 16
+    for y in (0, dy):
+        for r, line in enumerate(BULLET):
+            rows[y + r] = "".join(max(a, b) for a, b in zip(rows[y + r], line))
+    return rows[:8], rows[8:]
+
+
+def layout_8x16(sprites):
+    """Map logical sprite tile t to the 8x16 pair (2t, 2t + 1)
+
+    Single tiles get a blank lower half; main.c only remaps tile numbers
+    """
+    tiles = dict(sprites)
+    out = []
+    for tile_idx, tile_data in sprites:
+        if not any(b <= tile_idx < b + 4 for b in CAR_BASES):
+            out.append((tile_idx * 2, tile_data))
+    for b in CAR_BASES:
+        out += [(b * 2, tiles[b]), (b * 2 + 1, tiles[b + 2]),
+                (b * 2 + 2, tiles[b + 1]), (b * 2 + 3, tiles[b + 3])]
+    for dy in range(1, 9):
+        top, bottom = bullet_pair(dy)
+        t = (BULLET_PAIR + dy - 1) * 2
+        out += [(t, top), (t + 1, bottom)]
+    return out
+
+
 def main():
-    if len(sys.argv) < 2:
-        print("Usage: generate_chr.py <output.chr>")
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    if len(args) < 1:
+        print("Usage: generate_chr.py [--8x16] <output.chr>")
         sys.exit(1)
 
-    output_file = sys.argv[1]
+    output_file = args[0]
+    sprites_8x16 = "--8x16" in sys.argv
 
     # Build CHR-ROM (8KB = 8192 bytes)
     # Pattern table 0: 256 tiles for backgrounds ($0000-$0FFF)
@@ -975,6 +1037,9 @@ def main():
         (0x07, TILE_BAR_EMPTY),
         (0x08, TILE_CAR_ICON),
         (0x09, TILE_HLINE),
+        (0x0A, TILE_WALL),
+        (0x0B, HEART),           # HUD HP
+        (0x0C, TILE_LAP_MARK),
     ]
 
     # Add digits
@@ -1034,9 +1099,15 @@ def main():
     sprites.append((0x4C, DOT))
     # Smoke puff at 0x4D for exhaust animation
     sprites.append((0x4D, SMOKE))
+    # Name entry cursor at 0x4E (its own tile: 0x04-0x07 are the enemy car,
+    # and 8x16 layout keeps only the car pairs in that range)
+    sprites.append((0x4E, TILE_BAR_FILL))
 
     # Note: LAP display simplified to "LX" format, slash not needed
 
+    if sprites_8x16:
+        sprites = layout_8x16(sprites)
+
     # Write sprite tiles
     for tile_idx, tile_data in sprites:
         offset = 0x1000 + (tile_idx * 16)
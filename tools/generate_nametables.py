@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Generate RLE-packed nametables for the road screens (ca65 source)
+
+nt_race   - race road: grass sides, road, dashed center line
+nt_title  - title road: the same without the center line
+nt_hud    - HUD strip for $2400: the static frame hud_update() fills in
+
+Each is a full 1024-byte nametable (960 tiles + 64 attribute bytes) packed
+for vram_unrle in src/vram.s. The road layout must match road_tile() in
+main.c, which the wall layer uses to restore road cells.
+
+RLE format (as neslib's vram_unrle):
+  first byte   tag, a byte value that does not occur in the data
+  value        written to the PPU and remembered
+  tag, n       the remembered value written n more times (n = 1-255)
+  tag, 0       end of data
+"""
+
+import sys
+
+# Must match main.c
+TILE_ROAD = 0x01
+TILE_GRASS = 0x02
+TILE_LINE = 0x03
+TILE_BAR_EMPTY = 0x07
+TILE_HEART = 0x0B
+TILE_LAP_MARK = 0x0C
+TILE_LETTER = 0x20
+
+# HUD strip (must match main.c): rows 1-2 are shown above the road
+HUD_ROW_TEXT = 1
+HUD_ROW_BAR = 2
+HUD_HEART_COL = 3
+HUD_X_COL = 18                  # "x" before the multiplier
+HUD_BAR_COL = 2                 # S, 3 x (8 cells + lap mark), G in place of the last mark
+
+# Attribute row: palette 1 (grass) on the sides, palette 0 (road) between
+ATTR_ROW = [0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55]
+
+
+def road_tile(row, col, center_line):
+    if col < 5 or col >= 27:
+        return TILE_GRASS
+    if center_line and col in (15, 16) and (row & 1) == 0:
+        return TILE_LINE
+    return TILE_ROAD
+
+
+def nametable(center_line):
+    data = [road_tile(row, col, center_line) for row in range(30) for col in range(32)]
+    return data + ATTR_ROW * 8
+
+
+def letter(c):
+    return TILE_LETTER + ord(c) - ord('A')
+
+
+def hud_nametable():
+    data = [0] * 960
+    data[HUD_ROW_TEXT * 32 + HUD_HEART_COL] = TILE_HEART
+    data[HUD_ROW_TEXT * 32 + HUD_X_COL] = letter('X')
+    bar = [letter('S')]
+    for lap in range(3):
+        bar += [TILE_BAR_EMPTY] * 8 + [TILE_LAP_MARK]
+    bar[-1] = letter('G')
+    start = HUD_ROW_BAR * 32 + HUD_BAR_COL
+    data[start:start + len(bar)] = bar
+    # Rows 0-3: palette 2 (white), palette 3 (red) behind the heart
+    attr = [0xAE] + [0xAA] * 7 + [0x00] * 56
+    return data + attr
+
+
+def rle(data):
+    tag = min(range(256), key=data.count)
+    if data.count(tag):
+        raise ValueError("no free tag byte")
+    out = [tag]
+    i = 0
+    while i < len(data):
+        value = data[i]
+        n = 1
+        while i + n < len(data) and data[i + n] == value:
+            n += 1
+        i += n
+        out.append(value)
+        n -= 1
+        while n > 2:            # Repeats: tag, count (up to 255 at a time)
+            k = min(n, 255)
+            out += [tag, k]
+            n -= k
+        out += [value] * n      # One or two repeats are shorter as literals
+    return out + [tag, 0]
+
+
+def unrle(packed):
+    tag, out, i = packed[0], [], 1
+    while True:
+        if packed[i] != tag:
+            out.append(packed[i])
+            i += 1
+        elif packed[i + 1] == 0:
+            return out
+        else:
+            out += [out[-1]] * packed[i + 1]
+            i += 2
+
+
+def byte_rows(values, per_row=16):
+    lines = []
+    for i in range(0, len(values), per_row):
+        row = values[i:i + per_row]
+        lines.append("    .byte " + ", ".join("$%02X" % v for v in row))
+    return lines
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: generate_nametables.py <output.s>")
+        sys.exit(1)
+
+    output_file = sys.argv[1]
+
+    lines = [
+        "; Generated by tools/generate_nametables.py - do not edit",
+        "",
+        ".export _nt_race, _nt_title, _nt_hud",
+        "",
+        '.segment "RODATA"',
+    ]
+    screens = (("_nt_race", nametable(True)), ("_nt_title", nametable(False)),
+               ("_nt_hud", hud_nametable()))
+    for name, data in screens:
+        packed = rle(data)
+        assert unrle(packed) == data
+        lines += ["", "; %d bytes -> %d" % (len(data), len(packed)), name + ":"]
+        lines += byte_rows(packed)
+
+    with open(output_file, 'w') as f:
+        f.write("\n".join(lines) + "\n")
+
+    print(f"Generated {output_file}")
+
+
+if __name__ == "__main__":
+    main()
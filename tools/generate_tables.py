@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Generate lookup tables for the bullet system (ca65 source)
+
+vel_dxf/vel_dx/vel_dyf/vel_dy[256]
+               - 8.8 bullet velocity for a velocity id (class << 6) | dir
+                 Direction 0 = right, 16 = down, 32 = left, 48 = up
+                 Speed classes 0-3 = 2, 3, 4, 5 pixels per frame
+atan_tab[256]  - 8-bit atan: atan_tab[(ay << 4) | ax] is the direction
+                 (0-16) of the vector (ax, ay) with 0 <= ax, ay < 16
+pal_bright_tab[9 * 64]
+               - NES color at brightness level 0-8: [level * 64 + color]
+                 Level 4 is the color itself; each level below darkens it
+                 one luminance row (to black $0F), each level above
+                 brightens it one row (to white $30)
+"""
+
+import math
+import sys
+
+DIRECTIONS = 64
+SPEEDS = [2, 3, 4, 5]  # Pixels per frame for speed class 0-3
+BRIGHT_LEVELS = 9      # Palette brightness 0 (black) .. 4 (normal) .. 8 (white)
+
+
+def velocities():
+    """8.8 (dx, dy) for every velocity id, as signed 16-bit values"""
+    table = []
+    for speed in SPEEDS:
+        for d in range(DIRECTIONS):
+            angle = 2 * math.pi * d / DIRECTIONS
+            table.append((round(256 * speed * math.cos(angle)),
+                          round(256 * speed * math.sin(angle))))
+    return table
+
+
+def atan_tab():
+    table = []
+    for ay in range(16):
+        for ax in range(16):
+            if ax == 0 and ay == 0:
+                table.append(0)
+            else:
+                angle = math.atan2(ay, ax)  # 0 .. pi/2
+                table.append(round(angle * DIRECTIONS / (2 * math.pi)))
+    return table
+
+
+def pal_bright_tab():
+    table = []
+    for level in range(BRIGHT_LEVELS):
+        for color in range(64):
+            lum, hue = color >> 4, color & 0x0F
+            if hue >= 0x0E or (hue == 0x0D and lum < 2):
+                lum, hue = -1, 0       # Blacks: one row below the grays
+            elif hue == 0x0D:
+                lum, hue = lum - 2, 0  # $2D/$3D: the darker grays
+            lum += level - BRIGHT_LEVELS // 2
+            if lum < 0:
+                table.append(0x0F)
+            elif lum > 3:
+                table.append(0x30)
+            else:
+                table.append((lum << 4) | hue)
+    return table
+
+
+def byte_rows(values, per_row=16):
+    lines = []
+    for i in range(0, len(values), per_row):
+        row = values[i:i + per_row]
+        lines.append("    .byte " + ", ".join("$%02X" % (v & 0xFF) for v in row))
+    return lines
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: generate_tables.py <output.s>")
+        sys.exit(1)
+
+    output_file = sys.argv[1]
+
+    lines = [
+        "; Generated by tools/generate_tables.py - do not edit",
+        "",
+        ".export _vel_dxf, _vel_dx, _vel_dyf, _vel_dy, _atan_tab, _pal_bright_tab",
+        "",
+        '.segment "RODATA"',
+        "",
+    ]
+    vel = velocities()
+    for name, values in (
+            ("_vel_dxf", [dx & 0xFF for dx, dy in vel]),
+            ("_vel_dx", [dx >> 8 for dx, dy in vel]),
+            ("_vel_dyf", [dy & 0xFF for dx, dy in vel]),
+            ("_vel_dy", [dy >> 8 for dx, dy in vel])):
+        lines += ["; 8.8 velocity, index (speed class << 6) | direction", name + ":"]
+        lines += byte_rows(values)
+        lines.append("")
+    lines += [
+        "; atan2(ay, ax) in 1/64 turns, index (ay << 4) | ax",
+        "_atan_tab:",
+    ]
+    lines += byte_rows(atan_tab())
+    lines += [
+        "",
+        "; NES color at palette brightness 0-8 (4 = unchanged), index level * 64 + color",
+        "_pal_bright_tab:",
+    ]
+    lines += byte_rows(pal_bright_tab())
+
+    with open(output_file, 'w') as f:
+        f.write("\n".join(lines) + "\n")
+
+    print(f"Generated {output_file}")
+
+
+if __name__ == "__main__":
+    main()